@@ -0,0 +1,97 @@
+/*
+This file is part of the WASimCommander project.
+https://github.com/mpaperno/WASimCommander
+
+COPYRIGHT: (c) Maxim Paperno; All Rights Reserved.
+
+This file may be used under the terms of the GNU General Public License (GPL)
+as published by the Free Software Foundation, either version 3 of the Licenses,
+or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU GPL is included with this project
+and is also available at <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ModuleHarness.h"
+
+namespace ModuleTests::AllocationTests
+{
+
+static const uint32_t WARMUP_UPDATES = 10;
+static const uint32_t MEASURED_UPDATES = 1000;
+
+// Requests with each calculator result type and a named variable, all updated on every tick. The values change on every update so each one is written to the client.
+// The string sizes are larger than any small string buffer, so the result strings need heap storage.
+static const DataRequest g_requests[] = {
+	DataRequest(1, DATA_TYPE_INT32,  RequestType::Calculated, CalcResultType::Integer,   UpdatePeriod::Tick, "(A:GENERAL ENG RPM:1, rpm)"),
+	DataRequest(2, DATA_TYPE_DOUBLE, RequestType::Calculated, CalcResultType::Double,    UpdatePeriod::Tick, "(A:AIRSPEED INDICATED, knots)"),
+	DataRequest(3, DATA_TYPE_FLOAT,  RequestType::Calculated, CalcResultType::Double,    UpdatePeriod::Tick, "(A:INDICATED ALTITUDE, feet)"),
+	DataRequest(4, 32,               RequestType::Calculated, CalcResultType::String,    UpdatePeriod::Tick, "(A:ATC ID, string)"),
+	DataRequest(5, 64,               RequestType::Calculated, CalcResultType::Formatted, UpdatePeriod::Tick, "%((A:AIRSPEED INDICATED, knots))%!d! knots"),
+	DataRequest(6, DATA_TYPE_DOUBLE, RequestType::Named,      CalcResultType::Double,    UpdatePeriod::Tick, "ALLOC_TEST_LVAR", nullptr, 'L'),
+	DataRequest(7, DATA_TYPE_INT32,  RequestType::Named,      CalcResultType::Double,    UpdatePeriod::Tick, "PLANE ALTITUDE", "feet", 'A'),
+};
+
+// Sets up a client with all the test requests, then checks that updating each request on its own, and all of them in ticks, makes no more heap allocations once warmed up.
+bool run()
+{
+	resetModule();
+	register_named_variable("ALLOC_TEST_LVAR");
+	Client *c = connectTestClient(1);
+	for (const DataRequest &req : g_requests) {
+		if (!addTestRequest(c, req)) {
+			cout << "  Failed to add request " << req << endl;
+			return false;
+		}
+	}
+
+	double value = 0.0;
+	bool ok = true;
+
+	// each request on its own, with updateRequestValue() as used for scheduled and Update command updates
+	for (const DataRequest &req : g_requests) {
+		TrackedRequest *tr = findClientRequest(c, req.requestId);
+		for (uint32_t i = 0; i < WARMUP_UPDATES; ++i) {
+			g_sim.setValue(value += 1.0);
+			updateRequestValue(c, tr);
+		}
+		const uint64_t writes = g_sim.dataWriteCount;
+		const uint64_t allocs = g_allocationCount;
+		for (uint32_t i = 0; i < MEASURED_UPDATES; ++i) {
+			g_sim.setValue(value += 1.0);
+			updateRequestValue(c, tr);
+		}
+		const uint64_t count = g_allocationCount - allocs;
+		const bool written = g_sim.dataWriteCount - writes == MEASURED_UPDATES;
+		cout << "  " << setw(10) << setfill(' ') << left << (tr->requestType == RequestType::Named ? string("Named ") + tr->varTypePrefix : Utilities::getEnumName(tr->calcResultType, CalcResultTypeNames))
+			<< " request ID " << tr->requestId << ": " << count << " allocations in " << MEASURED_UPDATES << " updates" << (written ? "" : " (values were not written!)") << endl;
+		ok = ok && !count && written;
+	}
+
+	// all requests together, updated by tick() through the update schedule and evaluation cache
+	for (uint32_t i = 0; i < WARMUP_UPDATES; ++i) {
+		g_sim.setValue(value += 1.0);
+		runTick();
+	}
+	const uint64_t writes = g_sim.dataWriteCount;
+	const uint64_t allocs = g_allocationCount;
+	for (uint32_t i = 0; i < MEASURED_UPDATES; ++i) {
+		g_sim.setValue(value += 1.0);
+		runTick();
+	}
+	const uint64_t count = g_allocationCount - allocs;
+	const bool written = g_sim.dataWriteCount - writes == uint64_t(MEASURED_UPDATES) * size(g_requests);
+	cout << "  All requests in tick(): " << count << " allocations in " << MEASURED_UPDATES << " ticks" << (written ? "" : " (values were not written!)") << endl;
+
+	resetModule();
+	return ok && !count && written;
+}
+
+}  // ModuleTests::AllocationTests
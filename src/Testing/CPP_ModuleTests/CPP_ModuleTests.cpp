@@ -0,0 +1,129 @@
+/*
+This file is part of the WASimCommander project.
+https://github.com/mpaperno/WASimCommander
+
+COPYRIGHT: (c) Maxim Paperno; All Rights Reserved.
+
+This file may be used under the terms of the GNU General Public License (GPL)
+as published by the Free Software Foundation, either version 3 of the Licenses,
+or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU GPL is included with this project
+and is also available at <http://www.gnu.org/licenses/>.
+*/
+
+// Tests and benchmarks of the WASimModule server code, which is compiled into this program along with mock versions of the simulator APIs (see ModuleHarness.h).
+// Run with no arguments to run all the tests, "bench" to run all the benchmarks, or give the names of the tests/benchmarks to run. "list" shows the names.
+
+#include <cstdlib>
+#include <new>
+
+#include "ModuleHarness.h"
+#include "AllocationTests.h"
+#include "DispatchBenchmark.h"
+#include "GroupTests.h"
+#include "ListBenchmark.h"
+#include "LookupBenchmark.h"
+#include "TickBenchmark.h"
+
+// -----------------------------
+// Allocation counting
+// -----------------------------
+
+uint64_t ModuleTests::g_allocationCount = 0;
+
+void *operator new(std::size_t size)
+{
+	++ModuleTests::g_allocationCount;
+	if (void *p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+	return ::operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	++ModuleTests::g_allocationCount;
+	return std::malloc(size ? size : 1);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+	return ::operator new(size, tag);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { std::free(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { std::free(p); }
+
+// -----------------------------
+// Test list
+// -----------------------------
+
+struct TestCase
+{
+	const char *name;
+	bool isBenchmark;
+	bool (*run)();
+	const char *description;
+};
+
+static const TestCase g_testCases[] = {
+	{ "allocations", false, ModuleTests::AllocationTests::run, "Steady-state request updates make no heap allocations." },
+	{ "groups",      false, ModuleTests::GroupTests::run,      "Group requests are written as one record with their own change detection and update intervals." },
+	{ "tick",        true,  ModuleTests::TickBenchmark::run,   "Time per tick against the total number of requests, with a fixed number due." },
+	{ "listresults", true,  ModuleTests::ListBenchmark::run,   "L var names listed per second with unpacked and packed List results." },
+	{ "dispatch",    true,  ModuleTests::DispatchBenchmark::run, "Message dispatch and request lookups and request iteration, compared to std::map." },
+	{ "namelookup",  true,  ModuleTests::LookupBenchmark::run, "Key event and token variable name lookups, compared to std::map." },
+};
+
+static bool runTestCase(const TestCase &tc)
+{
+	cout << (tc.isBenchmark ? "Benchmark " : "Test ") << tc.name << ": " << tc.description << endl;
+	const bool ok = tc.run();
+	cout << (ok ? "PASSED " : "FAILED ") << tc.name << '\n' << endl;
+	return ok;
+}
+
+int main(int argc, char *argv[])
+{
+	ModuleTests::initModule();
+
+	int failed = 0;
+	if (argc < 2 || !strcmp(argv[1], "bench")) {
+		const bool benchmarks = argc > 1;
+		for (const TestCase &tc : g_testCases) {
+			if (tc.isBenchmark == benchmarks && !runTestCase(tc))
+				++failed;
+		}
+	}
+	else if (!strcmp(argv[1], "list")) {
+		for (const TestCase &tc : g_testCases)
+			cout << setw(14) << left << tc.name << (tc.isBenchmark ? " (benchmark) " : " ") << tc.description << endl;
+	}
+	else {
+		for (int i = 1; i < argc; ++i) {
+			const auto tc = std::find_if(cbegin(g_testCases), cend(g_testCases), [&](const TestCase &t) { return !strcmp(t.name, argv[i]); });
+			if (tc == cend(g_testCases)) {
+				cout << "Unknown test name: " << argv[i] << endl;
+				++failed;
+			}
+			else if (!runTestCase(*tc)) {
+				++failed;
+			}
+		}
+	}
+	return failed;
+}
@@ -0,0 +1,150 @@
+/*
+This file is part of the WASimCommander project.
+https://github.com/mpaperno/WASimCommander
+
+COPYRIGHT: (c) Maxim Paperno; All Rights Reserved.
+
+This file may be used under the terms of the GNU General Public License (GPL)
+as published by the Free Software Foundation, either version 3 of the Licenses,
+or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU GPL is included with this project
+and is also available at <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <random>
+
+#include "ModuleHarness.h"
+
+namespace ModuleTests::DispatchBenchmark
+{
+
+static const uint32_t CLIENT_COUNT = 16;
+static const uint32_t EVENTS_PER_CLIENT = 50;
+static const uint32_t REQUESTS_PER_CLIENT = 250;
+static const uint32_t LOOKUPS = 1000000;
+static const uint32_t ITERATIONS = 1000;
+
+// Returns the average time of `fn(key)` calls for all `keys`, repeated to make LOOKUPS calls in total, in nanoseconds.
+template <typename F>
+static double lookupNanoseconds(const vector<uint32_t> &keys, F &&fn)
+{
+	uintptr_t found = 0;
+	const steady_clock::time_point start = steady_clock::now();
+	for (uint32_t i = 0; i < LOOKUPS; ++i)
+		found += (uintptr_t)fn(keys[i % keys.size()]);
+	const double us = elapsedMicroseconds(start);
+	// keep the lookups from being optimized away
+	return found ? us * 1000.0 / LOOKUPS : 0.0;
+}
+
+// Returns the average time of `fn()` calls over ITERATIONS calls, in microseconds.
+template <typename F>
+static double iterationMicroseconds(F &&fn)
+{
+	uint64_t sum = 0;
+	const steady_clock::time_point start = steady_clock::now();
+	for (uint32_t i = 0; i < ITERATIONS; ++i)
+		sum += fn();
+	const double us = elapsedMicroseconds(start);
+	return sum ? us / ITERATIONS : 0.0;
+}
+
+static void printResult(const char *name, double current, double baseline, const char *unit)
+{
+	cout << "  " << setfill(' ') << left << setw(34) << name << right << fixed << setprecision(2) << setw(12) << current << setw(12) << baseline << ' ' << unit << defaultfloat << endl;
+}
+
+// Compares the lookups done when dispatching SimConnect messages, client request lookups, and iterating over requests with the module's tables
+// and with the std::map containers which they replaced. The std::map copies hold the same records, and the lookup keys are in random order.
+bool run()
+{
+	resetModule();
+	vector<uint32_t> definitionIds, eventIds, requestIds;
+	for (uint32_t id = 1; id <= CLIENT_COUNT; ++id) {
+		Client *c = connectTestClient(id);
+		for (const DWORD cddId : { c->cddID_command, c->cddID_request, c->cddID_keyEvent, c->cddID_commandBatch, c->cddID_setterStream, c->cddID_keyEventQueue })
+			definitionIds.push_back((uint32_t)cddId);
+		for (uint32_t i = 0; i < EVENTS_PER_CLIENT; ++i) {
+			const Command cmd(CommandId::Register, i, ("Event" + to_string(i) + "$" + to_string(i) + " (>K:TOGGLE_NAV_LIGHTS)").c_str());
+			createOrUpdateCustomEvent(c, &cmd);
+			if (const TrackedEvent *ev = findClientEvent(c, i))
+				eventIds.push_back(ev->clientEventId);
+		}
+		for (uint32_t i = 0; i < REQUESTS_PER_CLIENT; ++i) {
+			const string code = "(A:GENERAL ENG RPM:1, rpm) " + to_string(i) + " +";
+			addTestRequest(c, DataRequest(i * 7 + 1, CalcResultType::Double, code.c_str(), DATA_TYPE_DOUBLE, UpdatePeriod::Never));
+		}
+	}
+	Client *c = findClient(CLIENT_COUNT / 2);
+	for (const requestMap_t::value_type &rp : c->requests)
+		requestIds.push_back(rp.first);
+	if (definitionIds.size() != CLIENT_COUNT * 6 || eventIds.size() != CLIENT_COUNT * EVENTS_PER_CLIENT || requestIds.size() != REQUESTS_PER_CLIENT) {
+		cout << "  Failed to set up the clients" << endl;
+		resetModule();
+		return false;
+	}
+	mt19937 rng(12345);
+	std::shuffle(definitionIds.begin(), definitionIds.end(), rng);
+	std::shuffle(eventIds.begin(), eventIds.end(), rng);
+	std::shuffle(requestIds.begin(), requestIds.end(), rng);
+
+	// the containers used before
+	std::map<uint32_t, DefinitionIdRecord> definitionMap;
+	for (const uint32_t id : definitionIds)
+		definitionMap.emplace(id, *findDefinitionRecord(id));
+	std::map<uint32_t, EventIdRecord> eventMap;
+	for (const uint32_t id : eventIds)
+		eventMap.emplace(id, *findEventRecord(id));
+	vector<std::map<uint32_t, TrackedRequest>> clientRequestMaps;
+	for (const clientMap_t::value_type &cp : g_mClients)
+		clientRequestMaps.emplace_back(cp.second.requests.cbegin(), cp.second.requests.cend());
+	const std::map<uint32_t, TrackedRequest> requestMap(c->requests.cbegin(), c->requests.cend());
+
+	cout << "  " << CLIENT_COUNT << " clients with " << EVENTS_PER_CLIENT << " registered events and " << REQUESTS_PER_CLIENT << " requests each" << endl;
+	cout << "  " << setfill(' ') << left << setw(34) << "Operation" << right << setw(12) << "current" << setw(12) << "std::map" << endl;
+	printResult("Definition ID record lookup",
+		lookupNanoseconds(definitionIds, [](uint32_t id) { return findDefinitionRecord(id); }),
+		lookupNanoseconds(definitionIds, [&](uint32_t id) { const auto it = definitionMap.find(id); return it == definitionMap.cend() ? nullptr : &it->second; }),
+		"ns");
+	printResult("Event ID record lookup",
+		lookupNanoseconds(eventIds, [](uint32_t id) { return findEventRecord(id); }),
+		lookupNanoseconds(eventIds, [&](uint32_t id) { const auto it = eventMap.find(id); return it == eventMap.cend() ? nullptr : &it->second; }),
+		"ns");
+	printResult("Client request lookup",
+		lookupNanoseconds(requestIds, [c](uint32_t id) { return findClientRequest(c, id); }),
+		lookupNanoseconds(requestIds, [&](uint32_t id) { const auto it = requestMap.find(id); return it == requestMap.cend() ? nullptr : &it->second; }),
+		"ns");
+	// looping over all requests of all clients, as for Stats and when clients are paused or disconnected
+	printResult("Iterate all client requests",
+		iterationMicroseconds([]() {
+			uint64_t sum = 0;
+			for (const clientMap_t::value_type &cp : g_mClients) {
+				for (const requestMap_t::value_type &rp : cp.second.requests)
+					sum += rp.second.dataSize;
+			}
+			return sum;
+		}),
+		iterationMicroseconds([&]() {
+			uint64_t sum = 0;
+			for (const std::map<uint32_t, TrackedRequest> &requests : clientRequestMaps) {
+				for (const auto &rp : requests)
+					sum += rp.second.dataSize;
+			}
+			return sum;
+		}),
+		"us");
+
+	resetModule();
+	return true;
+}
+
+}  // ModuleTests::DispatchBenchmark
@@ -0,0 +1,102 @@
+/*
+This file is part of the WASimCommander project.
+https://github.com/mpaperno/WASimCommander
+
+COPYRIGHT: (c) Maxim Paperno; All Rights Reserved.
+
+This file may be used under the terms of the GNU General Public License (GPL)
+as published by the Free Software Foundation, either version 3 of the Licenses,
+or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU GPL is included with this project
+and is also available at <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ModuleHarness.h"
+
+namespace ModuleTests::GroupTests
+{
+
+// Members of the test groups: a SimVar, calculator code, and an L var with a delta epsilon larger than the value changes in the tests, so its changes are suppressed.
+static const char GROUP_MEMBERS[] = "+double;A;PLANE ALTITUDE;feet\nint32;Integer;(A:GENERAL ENG RPM:1, rpm)\ndouble;L;GROUP_TEST_LVAR;;5";
+static const uint32_t RECORD_SIZE = 1 + 8 + 4 + 8;  // the bitmap and the member values
+static const uint32_t MIN_INTERVAL_MS = 1000;
+
+// Returns the changed members bitmap of a group record.
+static uint8_t recordBitmap(const TrackedRequest *gr)
+{
+	return gr->data[0];
+}
+
+// Returns a member value from a group record at the given offset.
+template <typename T>
+static T recordValue(const TrackedRequest *gr, uint32_t offset)
+{
+	T value;
+	memcpy(&value, gr->data.data() + offset, sizeof(T));
+	return value;
+}
+
+// Prints a failed check and returns its result.
+static bool check(bool ok, const char *what)
+{
+	if (!ok)
+		cout << "  Check failed: " << what << endl;
+	return ok;
+}
+
+// Checks that a group with inline member definitions is tracked as one request with one data area, that changed members are written in one record
+// along with the changed members bitmap, that suppressed member changes are counted in the group's statistics, and that the group's minUpdateInterval holds back writes.
+bool run()
+{
+	resetModule();
+	register_named_variable("GROUP_TEST_LVAR");
+	Client *c = connectTestClient(1);
+	g_sim.setValue(100.0);
+
+	DataRequest req(1, RECORD_SIZE, RequestType::Group, CalcResultType::None, UpdatePeriod::Tick, GROUP_MEMBERS);
+	if (!check(addTestRequest(c, req), "group request was added"))
+		return false;
+	TrackedRequest *gr = findClientRequest(c, 1);
+	bool ok = check(c->requests.size() == 1 && gr->groupMembers.size() == 3, "members have no requests of their own");
+	ok = check(gr->stats.writeCount == 1 && recordBitmap(gr) == 0x07, "first record has all members") && ok;
+	ok = check(recordValue<double>(gr, 1) == 100.0 && recordValue<int32_t>(gr, 9) == 100 && recordValue<double>(gr, 13) == 100.0, "first record values") && ok;
+
+	// a change within the L var's epsilon is suppressed, and the L var keeps its previous value in the record
+	g_sim.resetCounters();
+	g_sim.setValue(101.0);
+	runTick();
+	ok = check(g_sim.dataWriteCount == 1 && recordBitmap(gr) == 0x03, "changed members are marked in the bitmap") && ok;
+	ok = check(recordValue<double>(gr, 1) == 101.0 && recordValue<int32_t>(gr, 9) == 101 && recordValue<double>(gr, 13) == 100.0, "changed record values") && ok;
+	ok = check(gr->stats.suppressedCount == 1 && gr->stats.evalCount >= 3 && gr->stats.writeCount == 2, "member statistics are counted in the group") && ok;
+
+	// no changes, no write
+	runTick();
+	ok = check(g_sim.dataWriteCount == 1, "unchanged record is not written") && ok;
+
+	// changes within the group's minimum interval are collected in the record and sent when the interval has passed
+	req.minUpdateInterval = MIN_INTERVAL_MS;
+	if (!check(addTestRequest(c, req), "group request was updated"))
+		return false;
+	g_sim.resetCounters();
+	g_sim.setValue(102.0);
+	runTick();
+	g_sim.setValue(103.0);
+	runTick();
+	ok = check(!g_sim.dataWriteCount && gr->pendingWrite, "changes within minUpdateInterval are held back") && ok;
+	gr->lastWrite -= milliseconds(MIN_INTERVAL_MS);
+	runTick();
+	ok = check(g_sim.dataWriteCount == 1 && !gr->pendingWrite && recordBitmap(gr) == 0x03 && recordValue<double>(gr, 1) == 103.0, "held back changes are written after minUpdateInterval") && ok;
+
+	resetModule();
+	return ok;
+}
+
+}  // ModuleTests::GroupTests
@@ -0,0 +1,78 @@
+/*
+This file is part of the WASimCommander project.
+https://github.com/mpaperno/WASimCommander
+
+COPYRIGHT: (c) Maxim Paperno; All Rights Reserved.
+
+This file may be used under the terms of the GNU General Public License (GPL)
+as published by the Free Software Foundation, either version 3 of the Licenses,
+or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU GPL is included with this project
+and is also available at <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ModuleHarness.h"
+
+namespace ModuleTests::ListBenchmark
+{
+
+static const uint32_t LOCAL_VAR_COUNT = 10000;
+static const uint32_t RUNS = 5;
+
+// Lists all the L vars with one List command and runs ticks until the results are complete. Returns the total time in microseconds and the number of ticks it took.
+static double listLocalVars(Client *c, bool packed, uint32_t &ticks)
+{
+	const Command cmd(CommandId::List, (uint32_t)LookupItemType::LocalVariable, nullptr, packed ? 1.0 : 0.0, 1);
+	ticks = 0;
+	const steady_clock::time_point start = steady_clock::now();
+	listItems(c, &cmd);
+	while (c->listCursor.active) {
+		advanceTime(milliseconds(TICK_PERIOD_MS));
+		tick();
+		++ticks;
+	}
+	return elapsedMicroseconds(start);
+}
+
+// Compares the time and number of data area writes needed to list a large number of L vars with individual List responses and in packed blocks.
+bool run()
+{
+	resetModule();
+	const size_t existingVars = g_sim.localVars.size();
+	for (uint32_t i = 0; i < LOCAL_VAR_COUNT; ++i)
+		register_named_variable(("A32NX_LIST_BENCHMARK_VARIABLE_" + to_string(i)).c_str());
+	const uint32_t varCount = (uint32_t)g_sim.localVars.size();
+	Client *c = connectTestClient(1);
+	bool ok = true;
+
+	cout << "  " << varCount << " L vars, " << g_listItemsPerTick << " items per tick, best of " << RUNS << " runs" << endl;
+	cout << "  " << setfill(' ') << right << setw(10) << "Mode" << setw(12) << "ms" << setw(16) << "names/s" << setw(10) << "ticks" << setw(10) << "writes" << setw(12) << "KB written" << endl;
+	for (const bool packed : { false, true }) {
+		double best = 0.0;
+		uint32_t ticks = 0;
+		for (uint32_t i = 0; i < RUNS; ++i) {
+			g_sim.resetCounters();
+			const double us = listLocalVars(c, packed, ticks);
+			if (!i || us < best)
+				best = us;
+		}
+		cout << "  " << fixed << setw(10) << (packed ? "Packed" : "Unpacked") << setprecision(2) << setw(12) << best / 1000.0 << setprecision(0) << setw(16) << varCount / (best / 1e6)
+			<< setw(10) << ticks << setw(10) << g_sim.dataWriteCount << setw(12) << g_sim.dataWriteBytes / 1024 << defaultfloat << endl;
+		// unpacked results are one response per item, plus the final Ack
+		ok = ok && (packed ? g_sim.dataWriteCount > 1 && g_sim.dataWriteCount < varCount / 100 : g_sim.dataWriteCount == varCount + 1);
+	}
+
+	resetModule();
+	g_sim.localVars.resize(existingVars);
+	return ok;
+}
+
+}  // ModuleTests::ListBenchmark
@@ -0,0 +1,102 @@
+/*
+This file is part of the WASimCommander project.
+https://github.com/mpaperno/WASimCommander
+
+COPYRIGHT: (c) Maxim Paperno; All Rights Reserved.
+
+This file may be used under the terms of the GNU General Public License (GPL)
+as published by the Free Software Foundation, either version 3 of the Licenses,
+or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU GPL is included with this project
+and is also available at <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <random>
+
+#include "ModuleHarness.h"
+
+namespace ModuleTests::LookupBenchmark
+{
+
+static const uint32_t LOOKUPS = 1000000;
+
+// Results of one set of lookups.
+struct Result
+{
+	double nanoseconds = 0.0;  // average time per lookup
+	double allocations = 0.0;  // average heap allocations per lookup
+	bool matched = true;       // all lookups found the expected result
+};
+
+// Looks up all `names` in random order, repeated to make LOOKUPS lookups in total. The names are passed as C strings, like the command and request strings which the module looks up.
+template <typename ID, typename F>
+static Result lookupNames(const vector<pair<string, ID>> &names, F &&fn)
+{
+	Result res;
+	const uint64_t allocs = g_allocationCount;
+	const steady_clock::time_point start = steady_clock::now();
+	for (uint32_t i = 0; i < LOOKUPS; ++i) {
+		const pair<string, ID> &name = names[i % names.size()];
+		res.matched = fn(name.first.c_str()) == name.second && res.matched;
+	}
+	res.nanoseconds = elapsedMicroseconds(start) * 1000.0 / LOOKUPS;
+	res.allocations = double(g_allocationCount - allocs) / LOOKUPS;
+	return res;
+}
+
+// Compares name to ID lookups in one of the compile-time tables with a std::map built from the same list, as the lookup functions used before.
+// The std::map version takes a `const std::string &` key, as the old functions did, so a string is constructed for each lookup.
+template <typename ID, size_t N>
+static bool compareTable(const char *name, const NameIdPair<ID> (&list)[N], ID (*lookup)(std::string_view))
+{
+	vector<pair<string, ID>> names;
+	for (const NameIdPair<ID> &el : list) {
+		// with duplicate names the first one is used, like std::map construction and the table do
+		if (std::none_of(names.cbegin(), names.cend(), [&](const pair<string, ID> &n) { return n.first == el.name; }))
+			names.emplace_back(el.name, el.id);
+	}
+	std::shuffle(names.begin(), names.end(), mt19937(12345));
+
+	// the map used to be built on the first lookup
+	const uint64_t allocs = g_allocationCount;
+	const steady_clock::time_point start = steady_clock::now();
+	std::map<std::string, ID> map;
+	for (const NameIdPair<ID> &el : list)
+		map.emplace(el.name, el.id);
+	const double buildTime = elapsedMicroseconds(start);
+	const uint64_t buildAllocs = g_allocationCount - allocs;
+	auto mapLookup = [&map](const std::string &key) {
+		const auto el = map.find(key);
+		return el == map.cend() ? ID(-1) : el->second;
+	};
+
+	const Result table = lookupNames(names, [lookup](const char *key) { return lookup(key); });
+	const Result old = lookupNames(names, [&](const char *key) { return mapLookup(key); });
+
+	cout << "  " << name << ": " << names.size() << " names; std::map construction took " << fixed << setprecision(0) << buildTime << "us and " << buildAllocs << " allocations" << endl;
+	cout << "  " << setfill(' ') << left << setw(14) << "" << right << setw(14) << "ns/lookup" << setw(16) << "allocs/lookup" << endl;
+	cout << "  " << left << setw(14) << "Table" << right << setprecision(2) << setw(14) << table.nanoseconds << setw(16) << table.allocations << endl;
+	cout << "  " << left << setw(14) << "std::map" << right << setw(14) << old.nanoseconds << setw(16) << old.allocations << defaultfloat << endl;
+	if (!table.matched || !old.matched)
+		cout << "  Lookup results do not match the name list!" << endl;
+	return table.matched && old.matched && !table.allocations;
+}
+
+// Compares the key event and token variable name lookups with the std::map versions they replaced.
+bool run()
+{
+	bool ok = compareTable("Key events", KEY_EVENT_NAMES, getKeyEventId);
+	ok = compareTable("Token variables", TOKEN_VARIABLE_NAMES, getTokenVariableId) && ok;
+	return ok;
+}
+
+}  // ModuleTests::LookupBenchmark
@@ -0,0 +1,280 @@
+/*
+This file is part of the WASimCommander project.
+https://github.com/mpaperno/WASimCommander
+
+COPYRIGHT: (c) Maxim Paperno; All Rights Reserved.
+
+This file may be used under the terms of the GNU General Public License (GPL)
+as published by the Free Software Foundation, either version 3 of the Licenses,
+or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU GPL is included with this project
+and is also available at <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// the MSVC runtime library uses different names for the POSIX functions which the module uses (the MSFS WASM runtime has them)
+#ifdef _MSC_VER
+#define strcasecmp _stricmp
+#define strncasecmp _strnicmp
+#endif
+
+// The module source is compiled as part of the test program, so the tests can use its internal functions and state directly.
+// The Gauge API and SimConnect functions which it uses are replaced by the mock versions below, which never touch a simulator.
+#include "WASimModule.cpp"
+
+namespace ModuleTests
+{
+
+// Number of heap allocations made through the global operator new since the program started, see CPP_ModuleTests.cpp
+extern uint64_t g_allocationCount;
+
+// State of the mock simulator which the Gauge API and SimConnect functions below use.
+struct MockSim
+{
+	double value = 0.0;          // value returned for all variables and numeric calculator results
+	char stringValue[32] = "";   // string returned for calculator results, set along with `value` in setValue()
+	vector<string> localVars {}; // names of L vars which "exist", the index is the variable ID
+	uint64_t calcCount = 0;      // number of execute_calculator_code() and format_calculator_string() calls
+	uint64_t varReadCount = 0;   // number of named variable, SimVar and token variable reads
+	uint64_t keyEventCount = 0;  // number of trigger_key_event_EX1() calls
+	uint64_t dataWriteCount = 0; // number of SimConnect_SetClientData() calls
+	uint64_t dataWriteBytes = 0; // total size of all SimConnect_SetClientData() calls
+
+	void setValue(double v) {
+		value = v;
+		snprintf(stringValue, sizeof(stringValue), "Value %.3f", v);
+	}
+
+	void resetCounters() {
+		calcCount = varReadCount = keyEventCount = dataWriteCount = dataWriteBytes = 0;
+	}
+};
+
+static MockSim g_sim {};
+
+}  // ModuleTests
+
+//----------------------------------------------------------------------------
+#pragma region Gauge API mocks
+//----------------------------------------------------------------------------
+
+BOOL execute_calculator_code(PCSTRINGZ, FLOAT64 *fvalue, SINT32 *ivalue, PCSTRINGZ *svalue)
+{
+	++ModuleTests::g_sim.calcCount;
+	if (fvalue)
+		*fvalue = ModuleTests::g_sim.value;
+	if (ivalue)
+		*ivalue = (SINT32)ModuleTests::g_sim.value;
+	if (svalue)
+		*svalue = ModuleTests::g_sim.stringValue;
+	return true;
+}
+
+BOOL format_calculator_string(PSTRINGZ result, UINT32 resultsize, PCSTRINGZ)
+{
+	++ModuleTests::g_sim.calcCount;
+	snprintf(result, resultsize, "%s", ModuleTests::g_sim.stringValue);
+	return true;
+}
+
+// "Compiles" code by returning the source, which is never actually parsed by the mock execute_calculator_code().
+BOOL gauge_calculator_code_precompile(PCSTRINGZ *pCompiled, UINT32 *pCompiledSize, PCSTRINGZ source)
+{
+	*pCompiled = source;
+	*pCompiledSize = (UINT32)strlen(source) + 1;
+	return true;
+}
+
+ID check_named_variable(PCSTRINGZ name)
+{
+	const vector<string> &vars = ModuleTests::g_sim.localVars;
+	const auto it = std::find(vars.cbegin(), vars.cend(), name);
+	return it == vars.cend() ? -1 : ID(it - vars.cbegin());
+}
+
+ID register_named_variable(PCSTRINGZ name)
+{
+	const ID id = check_named_variable(name);
+	if (id > -1)
+		return id;
+	ModuleTests::g_sim.localVars.emplace_back(name);
+	return ID(ModuleTests::g_sim.localVars.size() - 1);
+}
+
+PCSTRINGZ get_name_of_named_variable(ID id)
+{
+	const vector<string> &vars = ModuleTests::g_sim.localVars;
+	return id > -1 && (size_t)id < vars.size() ? vars[id].c_str() : nullptr;
+}
+
+FLOAT64 get_named_variable_value(ID)
+{
+	++ModuleTests::g_sim.varReadCount;
+	return ModuleTests::g_sim.value;
+}
+
+FLOAT64 get_named_variable_typed_value(ID, ENUM)
+{
+	++ModuleTests::g_sim.varReadCount;
+	return ModuleTests::g_sim.value;
+}
+
+void set_named_variable_value(ID, FLOAT64) { }
+void set_named_variable_typed_value(ID, FLOAT64, ENUM) { }
+
+// every SimVar and unit name is valid
+ENUM get_aircraft_var_enum(PCSTRINGZ) { return 1; }
+ENUM get_units_enum(PCSTRINGZ) { return 1; }
+
+FLOAT64 aircraft_varget(ENUM, ENUM, SINT32 index)
+{
+	++ModuleTests::g_sim.varReadCount;
+	return ModuleTests::g_sim.value + index;
+}
+
+void initialize_var_by_name(MODULE_VAR *module_var, PSTRINGZ)
+{
+	module_var->id = MODULE_VAR_NONE;
+}
+
+void lookup_var(MODULE_VAR *module_var)
+{
+	++ModuleTests::g_sim.varReadCount;
+	module_var->var_type = TYPE_FLOAT64;
+	module_var->var_value.n = ModuleTests::g_sim.value;
+}
+
+void trigger_key_event_EX1(ID32, UINT32, UINT32, UINT32, UINT32, UINT32)
+{
+	++ModuleTests::g_sim.keyEventCount;
+}
+
+#pragma endregion Gauge API mocks
+
+//----------------------------------------------------------------------------
+#pragma region SimConnect mocks
+//----------------------------------------------------------------------------
+
+HRESULT SimConnect_Open(HANDLE *phSimConnect, LPCSTR, HWND, DWORD, HANDLE, DWORD)
+{
+	*phSimConnect = (HANDLE)1;
+	return S_OK;
+}
+
+HRESULT SimConnect_Close(HANDLE) { return S_OK; }
+HRESULT SimConnect_CallDispatch(HANDLE, DispatchProc, void *) { return S_OK; }
+HRESULT SimConnect_SubscribeToSystemEvent(HANDLE, SIMCONNECT_CLIENT_EVENT_ID, const char *) { return S_OK; }
+HRESULT SimConnect_SetSystemEventState(HANDLE, SIMCONNECT_CLIENT_EVENT_ID, SIMCONNECT_STATE) { return S_OK; }
+HRESULT SimConnect_TransmitClientEvent(HANDLE, SIMCONNECT_OBJECT_ID, SIMCONNECT_CLIENT_EVENT_ID, DWORD, SIMCONNECT_NOTIFICATION_GROUP_ID, SIMCONNECT_EVENT_FLAG) { return S_OK; }
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE, SIMCONNECT_CLIENT_DATA_DEFINITION_ID, DWORD, DWORD, float, DWORD) { return S_OK; }
+HRESULT SimConnect_ClearClientDataDefinition(HANDLE, SIMCONNECT_CLIENT_DATA_DEFINITION_ID) { return S_OK; }
+HRESULT SimConnect_MapClientDataNameToID(HANDLE, const char *, SIMCONNECT_CLIENT_DATA_ID) { return S_OK; }
+HRESULT SimConnect_CreateClientData(HANDLE, SIMCONNECT_CLIENT_DATA_ID, DWORD, SIMCONNECT_CREATE_CLIENT_DATA_FLAG) { return S_OK; }
+HRESULT SimConnect_MapClientEventToSimEvent(HANDLE, SIMCONNECT_CLIENT_EVENT_ID, const char *) { return S_OK; }
+HRESULT SimConnect_AddClientEventToNotificationGroup(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, SIMCONNECT_CLIENT_EVENT_ID, BOOL) { return S_OK; }
+HRESULT SimConnect_SetNotificationGroupPriority(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, DWORD) { return S_OK; }
+HRESULT SimConnect_RemoveClientEvent(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, SIMCONNECT_CLIENT_EVENT_ID) { return S_OK; }
+HRESULT SimConnect_RequestClientData(HANDLE, SIMCONNECT_CLIENT_DATA_ID, SIMCONNECT_DATA_REQUEST_ID, SIMCONNECT_CLIENT_DATA_DEFINITION_ID, SIMCONNECT_CLIENT_DATA_PERIOD, SIMCONNECT_CLIENT_DATA_REQUEST_FLAG, DWORD, DWORD, DWORD) { return S_OK; }
+
+HRESULT SimConnect_GetLastSentPacketID(HANDLE, DWORD *pdwError)
+{
+	*pdwError = 0;
+	return S_OK;
+}
+
+HRESULT SimConnect_SetClientData(HANDLE, SIMCONNECT_CLIENT_DATA_ID, SIMCONNECT_CLIENT_DATA_DEFINITION_ID, SIMCONNECT_CLIENT_DATA_SET_FLAG, DWORD, DWORD cbUnitSize, void *)
+{
+	++ModuleTests::g_sim.dataWriteCount;
+	ModuleTests::g_sim.dataWriteBytes += cbUnitSize;
+	return S_OK;
+}
+
+#pragma endregion SimConnect mocks
+
+//----------------------------------------------------------------------------
+#pragma region Test helpers
+//----------------------------------------------------------------------------
+
+namespace ModuleTests
+{
+
+// Gives access to the container of the module's update schedule queue.
+struct ScheduleAccess : updateSchedule_t
+{
+	static vector<ScheduledUpdate> &entries(updateSchedule_t &q) { return q.*&ScheduleAccess::c; }
+};
+
+// Sets up the module state as module_init() would, without reading the config file or connecting to SimConnect. Log messages of at least `logLevel` are printed to the console.
+inline void initModule(LogLevel logLevel = LogLevel::Warning)
+{
+	logfault::LogManager::Instance().AddHandler(make_unique<logfault::StreamHandler>(cout, logfault::LogLevel(logLevel)));
+	SimConnect_Open(&g_hSimConnect, WSMCMND_SERVER_NAME, (HWND)nullptr, 0, 0, -1);
+}
+
+// Disconnects and removes all clients and clears any pending updates, so each test starts from the same state.
+inline void resetModule()
+{
+	for (clientMap_t::value_type &cp : g_mClients)
+		disconnectClient(&cp.second);
+	g_mClients.clear();
+	g_mDefinitionIds = definitionIdMap_t();
+	g_mEventIds = eventIdMap_t();
+	g_updateSchedule = updateSchedule_t();
+	g_evalCache.clear();
+	g_sim.resetCounters();
+}
+
+// Creates a client with the given ID and connects it, as if it had sent the Connect event.
+inline Client *connectTestClient(uint32_t clientId)
+{
+	return connectClient(clientId);
+}
+
+// Adds a data request to a client, as if the client had written it to its request data area. Returns false if the request was rejected.
+inline bool addTestRequest(Client *c, const DataRequest &req)
+{
+	return addOrUpdateRequest(c, &req);
+}
+
+// Makes the next tick() call run a full tick, as if `elapsed` time had passed since the last one, by moving the due times of all queued updates back by that much.
+// This also keeps the client connections from timing out, so ticks can be run back to back.
+inline void advanceTime(steady_clock::duration elapsed)
+{
+	// all entries move by the same amount, which keeps the heap order valid
+	for (ScheduledUpdate &su : ScheduleAccess::entries(g_updateSchedule))
+		su.due -= elapsed;
+	for (clientMap_t::value_type &cp : g_mClients)
+		updateClientTimeout(&cp.second);
+	g_tpNextTick = steady_clock::now();
+}
+
+// Runs one tick of the module with every queued update due, regardless of how much time has passed since the last tick.
+// This keeps the client connections from timing out and lets the tests run ticks back to back.
+inline void runTick()
+{
+	const steady_clock::time_point now = steady_clock::now();
+	// all entries get the same due time, which keeps the heap order valid
+	for (ScheduledUpdate &su : ScheduleAccess::entries(g_updateSchedule))
+		su.due = now;
+	for (clientMap_t::value_type &cp : g_mClients)
+		updateClientTimeout(&cp.second);
+	g_tpNextTick = now;
+	tick();
+}
+
+// Returns the time since `start` in microseconds.
+inline double elapsedMicroseconds(const steady_clock::time_point &start)
+{
+	return duration<double, std::micro>(steady_clock::now() - start).count();
+}
+
+}  // ModuleTests
+
+#pragma endregion Test helpers
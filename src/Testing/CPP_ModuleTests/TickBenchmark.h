@@ -0,0 +1,120 @@
+/*
+This file is part of the WASimCommander project.
+https://github.com/mpaperno/WASimCommander
+
+COPYRIGHT: (c) Maxim Paperno; All Rights Reserved.
+
+This file may be used under the terms of the GNU General Public License (GPL)
+as published by the Free Software Foundation, either version 3 of the Licenses,
+or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU GPL is included with this project
+and is also available at <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ModuleHarness.h"
+
+namespace ModuleTests::TickBenchmark
+{
+
+static const uint32_t CLIENT_COUNT = 4;
+static const uint32_t DUE_PER_TICK = 100;       // number of requests updated on every tick, split between the clients
+static const uint32_t WARMUP_TICKS = 10;
+static const uint32_t MEASURED_TICKS = 400;     // 10s of simulated time, so the long interval requests never come due while measuring
+static const uint32_t LONG_INTERVAL_MS = 60000;
+static const uint32_t REQUEST_COUNTS[] = { 100, 1000, 5000, 20000 };
+
+// Adds `count` requests spread over the test clients. DUE_PER_TICK of them are updated on every tick, and the rest are split between
+// requests with Never and Once periods and ones with a long update interval, none of which are due during the measured ticks.
+static bool addRequests(uint32_t count)
+{
+	for (uint32_t i = 0; i < count; ++i) {
+		UpdatePeriod period = UpdatePeriod::Tick;
+		uint32_t interval = 0;
+		if (i >= DUE_PER_TICK) {
+			switch (i % 3) {
+				case 0: period = UpdatePeriod::Never; break;
+				case 1: period = UpdatePeriod::Once; break;
+				default: period = UpdatePeriod::Millisecond; interval = LONG_INTERVAL_MS; break;
+			}
+		}
+		// each request gets unique code, so the evaluation cache does not merge them
+		const string code = "(A:GENERAL ENG RPM:1, rpm) " + to_string(i) + " +";
+		DataRequest req(i + 1, CalcResultType::Double, code.c_str(), DATA_TYPE_DOUBLE, period);
+		req.interval = interval;  // the constructors take an 8-bit interval
+		if (!addTestRequest(findClient(1 + i % CLIENT_COUNT), req))
+			return false;
+	}
+	return true;
+}
+
+// Time to loop over every request and check if it is due, which is what tick() did before requests were kept in the update schedule.
+static double fullScanMicroseconds(const steady_clock::time_point &now)
+{
+	const steady_clock::time_point start = steady_clock::now();
+	uint32_t due = 0;
+	for (clientMap_t::value_type &cp : g_mClients) {
+		for (requestMap_t::value_type &rp : cp.second.requests) {
+			if (rp.second.period >= UpdatePeriod::Tick && rp.second.nextUpdate <= now)
+				++due;
+		}
+	}
+	const double us = elapsedMicroseconds(start);
+	// keep the loop from being optimized away
+	return due == UINT32_MAX ? 0.0 : us;
+}
+
+// Measures the average time of a tick with a fixed number of due updates, against the total number of requests.
+bool run()
+{
+	// all long interval requests should be first updated right away, not spread over the measured period
+	const bool stagger = g_staggerUpdates;
+	g_staggerUpdates = false;
+	bool ok = true;
+	double value = 0.0;
+
+	cout << "  " << DUE_PER_TICK << " requests due per tick, " << CLIENT_COUNT << " clients" << endl;
+	cout << "  " << setfill(' ') << right << setw(10) << "Requests" << setw(14) << "us/tick" << setw(16) << "updates/tick" << setw(22) << "full scan us/tick" << endl;
+	for (const uint32_t count : REQUEST_COUNTS) {
+		resetModule();
+		for (uint32_t id = 1; id <= CLIENT_COUNT; ++id)
+			connectTestClient(id);
+		if (!addRequests(count)) {
+			cout << "  Failed to add " << count << " requests" << endl;
+			ok = false;
+			break;
+		}
+		for (uint32_t i = 0; i < WARMUP_TICKS; ++i) {
+			g_sim.setValue(value += 1.0);
+			advanceTime(milliseconds(TICK_PERIOD_MS));
+			tick();
+		}
+		g_sim.resetCounters();
+		double tickTime = 0.0, scanTime = 0.0;
+		for (uint32_t i = 0; i < MEASURED_TICKS; ++i) {
+			g_sim.setValue(value += 1.0);
+			advanceTime(milliseconds(TICK_PERIOD_MS));
+			const steady_clock::time_point start = steady_clock::now();
+			tick();
+			tickTime += elapsedMicroseconds(start);
+			scanTime += fullScanMicroseconds(start);
+		}
+		const uint64_t updates = g_sim.calcCount;
+		cout << "  " << fixed << setprecision(2) << setw(10) << count << setw(14) << tickTime / MEASURED_TICKS << setw(16) << updates / MEASURED_TICKS
+			<< setw(22) << scanTime / MEASURED_TICKS << defaultfloat << endl;
+		ok = ok && updates == uint64_t(DUE_PER_TICK) * MEASURED_TICKS;
+	}
+
+	resetModule();
+	g_staggerUpdates = stagger;
+	return ok;
+}
+
+}  // ModuleTests::TickBenchmark
@@ -72,11 +72,11 @@ DataRequestRecord::DataRequestRecord() :
 
 DataRequestRecord::DataRequestRecord(const DataRequest &req) :
 	DataRequest(req),
-	data(Utilities::getActualValueSize(valueSize), 0xFF) { }
+	data(Utilities::getRequestDataSize(req), 0xFF) { }
 
 DataRequestRecord::DataRequestRecord(DataRequest &&req) :
 	DataRequest(req),
-	data(Utilities::getActualValueSize(valueSize), 0xFF) { }
+	data(Utilities::getRequestDataSize(req), 0xFF) { }
 
 #pragma endregion
 
@@ -115,10 +115,21 @@ class WASimClient::Private
 		CLI_DATA_RESPONSE,
 		CLI_DATA_REQUEST,
 		CLI_DATA_KEYEVENT,
+		CLI_DATA_KEYQUEUE,
 		CLI_DATA_LOG,
+		CLI_DATA_PACKED,
+		CLI_DATA_LIST,
+		CLI_DATA_LOGDATA,
+		CLI_DATA_CMDBATCH,
+		CLI_DATA_BATCHRES,
+		CLI_DATA_SETTER,
 		// SIMCONNECT_DATA_REQUEST_ID - requests for data updates
 		DATA_REQ_RESPONSE,   // command response data
 		DATA_REQ_LOG,        // server log data
+		DATA_REQ_PACKED,     // packed data request value updates
+		DATA_REQ_LIST,       // packed list results
+		DATA_REQ_LOGDATA,    // packed server log records
+		DATA_REQ_BATCHRES,   // packed command batch results
 
 		SIMCONNECTID_LAST    // dynamic IDs start at this value
 
@@ -135,14 +146,14 @@ class WASimClient::Private
 		explicit TrackedRequest(const DataRequest &req, uint32_t dataId) :
 			DataRequest(req),
 			dataId{dataId},
-			dataSize{Utilities::getActualValueSize(valueSize)},
+			dataSize{Utilities::getRequestDataSize(req)},
 			data(dataSize, 0xFF)
 		{ }
 
 		TrackedRequest & operator=(const DataRequest &req) {
-			if (req.valueSize != valueSize) {
+			if (req.valueSize != valueSize || req.simVarIndexCount != simVarIndexCount) {
 				unique_lock lock(m_dataMutex);
-				dataSize = Utilities::getActualValueSize(req.valueSize);
+				dataSize = Utilities::getRequestDataSize(req);
 				data = vector<uint8_t>(dataSize, 0xFF);
 			}
 			DataRequest::operator=(req);
@@ -206,6 +217,33 @@ class WASimClient::Private
 
 	} listResult;
 
+	struct TempStatsResult {
+		atomic_bool pending = false;
+		uint32_t token { 0 };
+		vector<StatsRecord> result;
+		std::mutex mutex;
+	} statsResult;
+
+	struct TempBatchResult {
+		atomic_bool pending = false;
+		uint32_t token { 0 };
+		vector<Command> result;
+		std::mutex mutex;
+	} batchResult;
+
+	struct KeyEventQueue {
+		uint8_t block[KEY_EVENT_QUEUE_AREA_SIZE] {};  // KeyEventQueueHeader followed by the KeyEvent ring buffer slots
+		std::mutex mutex;
+
+		KeyEventQueueHeader *header() { return reinterpret_cast<KeyEventQueueHeader *>(block); }
+		KeyEvent *slots() { return reinterpret_cast<KeyEvent *>(block + sizeof(KeyEventQueueHeader)); }
+
+		void reset() {
+			lock_guard lock(mutex);
+			memset(block, 0, KEY_EVENT_QUEUE_AREA_SIZE);
+		}
+	} keyEventQueue;
+
 	struct ProgramSettings {
 		filesystem::path logFilePath;
 		int networkConfigId = -1;
@@ -236,7 +274,16 @@ class WASimClient::Private
 	atomic_bool simConnected = false;
 	atomic_bool serverConnected = false;
 	atomic_bool logCDAcreated = false;
+	atomic_bool packedCDAcreated = false;
+	atomic_bool listCDAcreated = false;
+	atomic_bool logDataCDAcreated = false;
+	atomic_bool batchResCDAcreated = false;
 	atomic_bool requestsPaused = false;
+	atomic_bool packedDataUpdates = false;
+	atomic<uint32_t> updateHeartbeat = 0;
+	atomic<float> deltaHysteresis = 0.0f;
+	atomic_bool suppressAcks = false;
+	atomic_bool keyEventQueueEnabled = false;  // server accepted ClientOption::KeyEventQueue
 
 	HANDLE hSim = nullptr;
 	HANDLE hSimEvent = nullptr;
@@ -263,6 +310,9 @@ class WASimClient::Private
 	unordered_map<std::string, uint32_t> keyEventNameCache {};
 	shared_mutex mtxKeyEventNames;
 	uint32_t nextCustomEventID = CUSTOM_KEY_EVENT_ID_MIN;  // auto-generated IDs for custom event registrations
+	// Key Event IDs which the server should coalesce, see `setKeyEventCoalescing()`; sent to server again on (re)connect.
+	set<uint32_t> coalescedKeyEventIds {};
+	mutable shared_mutex mtxCoalescedKeyEvents;
 
 	// Saved mappings of variable names to SIMCONNECT_DATA_DEFINITION_ID values we assigned to them.
 	// Used for setting string values on SimVars, which we do locally since WASM module can't.
@@ -598,6 +648,12 @@ class WASimClient::Private
 		registerDataArea(CDA_NAME_DATA_PFX, CLI_DATA_REQUEST, CLI_DATA_REQUEST, sizeof(DataRequest), true);
 		// register CDA for writing key events (this is read-only for the server)
 		registerDataArea(CDA_NAME_KEYEV_PFX, CLI_DATA_KEYEVENT, CLI_DATA_KEYEVENT, sizeof(KeyEvent), true);
+		// register CDA for writing queued key events, used if the server supports it (this is read-only for the server)
+		registerDataArea(CDA_NAME_KEYQUEUE_PFX, CLI_DATA_KEYQUEUE, CLI_DATA_KEYQUEUE, KEY_EVENT_QUEUE_AREA_SIZE, true);
+		// register CDA for writing command batches (this is read-only for the server)
+		registerDataArea(CDA_NAME_CMDBATCH_PFX, CLI_DATA_CMDBATCH, CLI_DATA_CMDBATCH, COMMAND_BATCH_AREA_SIZE, true);
+		// register CDA for writing streamed local variable values (this is read-only for the server)
+		registerDataArea(CDA_NAME_SETTER_PFX, CLI_DATA_SETTER, CLI_DATA_SETTER, SETTER_STREAM_AREA_SIZE, true);
 
 		// start listening on the response channel
 		if FAILED(hr = INVOKE_SIMCONNECT(
@@ -639,6 +695,10 @@ class WASimClient::Private
 		// reset flags/counters
 		simConnected = false;
 		logCDAcreated = false;
+		packedCDAcreated = false;
+		listCDAcreated = false;
+		logDataCDAcreated = false;
+		batchResCDAcreated = false;
 		totalDataAlloc = 0;
 
 		// dispose objects
@@ -694,12 +754,31 @@ class WASimClient::Private
 			LOG_WRN << "Server major version does not match WASimClient version " << STREAM_HEX8(WSMCMND_VERSION);
 		setStatus(ClientStatus::Connected);
 
+		// use the key event queue if the server supports it, otherwise fall back to writing single key events; the queue sequence restarts when it is enabled
+		keyEventQueue.reset();
+		keyEventQueueEnabled = SUCCEEDED(sendClientOption(ClientOption::KeyEventQueue, 1.0, true));
+		if (!keyEventQueueEnabled)
+			LOG_INF << "Server does not support the key event queue, key events will be sent individually.";
 		// clear any pending list request (unlikely)
 		listResult.reset();
 		// make sure server knows our desired log level and set up data area/request if needed
 		updateServerLogLevel();
 		// set update status of data requests before adding any, in case we don't actually want results yet
 		sendServerCommand(Command(CommandId::Subscribe, (requestsPaused ? 0 : 1)));
+		// enable packed data updates if needed, also before adding any requests
+		if (packedDataUpdates)
+			updateServerPackedDataUpdates(false);
+		if (updateHeartbeat)
+			sendClientOption(ClientOption::UpdateHeartbeat, updateHeartbeat, false);
+		if (deltaHysteresis > 0.0f)
+			sendClientOption(ClientOption::DeltaEpsilonHysteresis, deltaHysteresis, false);
+		if (suppressAcks)
+			sendClientOption(ClientOption::SuppressAcks, 1.0, false);
+		{
+			shared_lock lock(mtxCoalescedKeyEvents);
+			for (const uint32_t keyId : coalescedKeyEventIds)
+				sendClientOption(ClientOption::CoalesceKeyEvent, keyId, false);
+		}
 		// (re-)register (or delete) any saved DataRequests
 		registerAllDataRequests();
 		// same with calculator events
@@ -722,6 +801,7 @@ class WASimClient::Private
 		reponses.clear();
 
 		serverConnected = false;
+		keyEventQueueEnabled = false;
 		LOG_INF << "Disconnected from " WSMCMND_PROJECT_NAME " server.";
 		setStatus(ClientStatus::SimConnected);
 	}
@@ -790,6 +870,128 @@ class WASimClient::Private
 		return hr;
 	}
 
+	HRESULT registerBatchResultsDataArea()
+	{
+		if (batchResCDAcreated)
+			return S_OK;
+		HRESULT hr;
+		// register batch results area for reading; server can write to this channel
+		if SUCCEEDED(hr = registerDataArea(CDA_NAME_BATCHRES_PFX, CLI_DATA_BATCHRES, CLI_DATA_BATCHRES, COMMAND_BATCH_AREA_SIZE, false)) {
+			// start listening on the batch results channel
+			hr = INVOKE_SIMCONNECT(RequestClientData, hSim, (SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_BATCHRES, (SIMCONNECT_DATA_REQUEST_ID)DATA_REQ_BATCHRES,
+			                       (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_BATCHRES, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL);
+		}
+		batchResCDAcreated = SUCCEEDED(hr);
+		return hr;
+	}
+
+	// Sends commands in as many batches as needed to fit them into the command batch data area, waiting for the results of each batch before sending the next one.
+	HRESULT sendCommandBatches(const vector<Command> &commands, vector<Command> *responses, uint32_t timeout)
+	{
+		if (!isConnected()) {
+			LOG_ERR << "Server not connected, cannot send command batch.";
+			return E_NOT_CONNECTED;
+		}
+		if (batchResult.pending.exchange(true)) {
+			LOG_ERR << "A command batch is currently pending.";
+			return E_INVALIDARG;
+		}
+		HRESULT hr = registerBatchResultsDataArea();
+		size_t next = 0;
+		vector<uint8_t> block;
+		block.reserve(COMMAND_BATCH_AREA_SIZE);
+		while (SUCCEEDED(hr) && next < commands.size()) {
+			block.assign(sizeof(CommandBatchHeader), 0);
+			CommandBatchHeader hdr { nextCmdToken++, 0, 0 };
+			while (next < commands.size() && appendCommandBatchRecord(block, commands[next]))
+				++next, ++hdr.recordCount;
+			hdr.dataSize = uint16_t(block.size() - sizeof(CommandBatchHeader));
+			memcpy(block.data(), &hdr, sizeof(CommandBatchHeader));
+			block.resize(COMMAND_BATCH_AREA_SIZE);
+			hr = sendCommandBatch(block, hdr.token, responses, timeout);
+		}
+		batchResult.pending = false;
+		return hr;
+	}
+
+	// Writes one command batch block and waits for the final Ack/Nak response. Results received before it are appended to `responses`, if any.
+	HRESULT sendCommandBatch(const vector<uint8_t> &block, uint32_t token, vector<Command> *responses, uint32_t timeout)
+	{
+		shared_ptr<condition_variable_any> cv = make_shared<condition_variable_any>();
+		unique_lock lock(batchResult.mutex);
+		batchResult.result.clear();
+		// the token needs to be set before any results arrive, which are blocked by the lock until then
+		batchResult.token = token;
+		enqueueTrackedResponse(token, weak_ptr(cv));
+		LOG_TRC << "Sending command batch " << token << " of size " << reinterpret_cast<const CommandBatchHeader *>(block.data())->dataSize;
+		HRESULT hr = INVOKE_SIMCONNECT(SetClientData, hSim,
+			(SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_CMDBATCH, (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_CMDBATCH,
+			SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL, (DWORD)COMMAND_BATCH_AREA_SIZE, (void *)block.data()
+		);
+		lock.unlock();
+		if FAILED(hr) {
+			unique_lock vlock(mtxResponses);
+			reponses.erase(token);
+		}
+		else {
+			// the results are all received before the final Ack
+			Command response;
+			if FAILED(hr = waitCommandResponse(token, &response, timeout))
+				LOG_ERR << "Command batch timed out after " << (timeout ? timeout : settings.networkTimeout) << "ms.";
+			else if (response.commandId != CommandId::Ack) {
+				LOG_WRN << "Command batch returned Nak response. Reason, if any: " << quoted(response.sData);
+				hr = E_FAIL;
+			}
+		}
+		lock.lock();
+		if (SUCCEEDED(hr) && responses)
+			responses->insert(responses->end(), batchResult.result.cbegin(), batchResult.result.cend());
+		batchResult.result.clear();
+		batchResult.token = 0;
+		return hr;
+	}
+
+	// Decodes a block of command batch results from the batch results area, see CommandBatchHeader for format.
+	void onBatchResults(const uint8_t *data, size_t dataSize)
+	{
+		if (dataSize < sizeof(CommandBatchHeader)) {
+			LOG_CRT << "Invalid batch results block size! Expected at least " << sizeof(CommandBatchHeader) << " but got " << dataSize;
+			return;
+		}
+		const CommandBatchHeader *const hdr = reinterpret_cast<const CommandBatchHeader *const>(data);
+		if (hdr->dataSize > dataSize - sizeof(CommandBatchHeader)) {
+			LOG_CRT << "Invalid batch results block size! Reported size " << hdr->dataSize << " exceeds available " << dataSize - sizeof(CommandBatchHeader);
+			return;
+		}
+		if (hdr->recordCount > hdr->dataSize / sizeof(CommandBatchRecord)) {
+			LOG_CRT << "Invalid batch results block, record count " << hdr->recordCount << " exceeds block size " << hdr->dataSize;
+			return;
+		}
+		LOG_TRC << "Got batch results block with " << hdr->recordCount << " records of total size " << hdr->dataSize;
+		vector<Command> results(hdr->recordCount);
+		const uint8_t *pos = data + sizeof(CommandBatchHeader);
+		const uint8_t *const end = pos + hdr->dataSize;
+		for (Command &cmd : results) {
+			if (!readCommandBatchRecord(pos, end, cmd)) {
+				LOG_CRT << "Invalid batch results block, record " << (&cmd - results.data()) << " exceeds block size.";
+				return;
+			}
+		}
+		{
+			lock_guard lock(batchResult.mutex);
+			if (hdr->token != batchResult.token) {
+				LOG_WRN << "Received unexpected batch results block for wrong batch token. Expected " << batchResult.token << " got " << hdr->token;
+				return;
+			}
+			batchResult.result.insert(batchResult.result.end(), results.cbegin(), results.cend());
+		}
+		// invoke response callback if anyone is listening, same as for individual command responses
+		if (respCb) {
+			for (const Command &cmd : results)
+				invokeCallback(respCb, cmd);
+		}
+	}
+
 #pragma endregion
 #pragma region  Command Response tracking  ----------------------------------------------
 
@@ -893,6 +1095,42 @@ class WASimClient::Private
 		listResult.reset();  // reset to none to indicate the current list request is finished
 	}
 
+	// Decodes a block of packed list results from the list data area, see ListDataHeader for format.
+	void onListData(const uint8_t *data, size_t dataSize)
+	{
+		if (dataSize < sizeof(ListDataHeader)) {
+			LOG_CRT << "Invalid list data block size! Expected at least " << sizeof(ListDataHeader) << " but got " << dataSize;
+			return;
+		}
+		const ListDataHeader *const hdr = reinterpret_cast<const ListDataHeader *const>(data);
+		if (hdr->dataSize > dataSize - sizeof(ListDataHeader)) {
+			LOG_CRT << "Invalid list data block size! Reported size " << hdr->dataSize << " exceeds available " << dataSize - sizeof(ListDataHeader);
+			return;
+		}
+		unique_lock lock(listResult.mutex);
+		if (hdr->token != listResult.token) {
+			LOG_WRN << "Received unexpected list results block for wrong command token. Expected " << listResult.token << " got " << hdr->token;
+			return;
+		}
+		LOG_TRC << "Got list results block with " << hdr->itemCount << " items of total size " << hdr->dataSize;
+		listResult.nextTimeout = Clock::now() + chrono::milliseconds(settings.networkTimeout);
+		listResult.result.reserve(listResult.result.size() + hdr->itemCount);
+		const char *pos = reinterpret_cast<const char *>(data + sizeof(ListDataHeader));
+		const char *const end = pos + hdr->dataSize;
+		for (uint16_t i = 0; i < hdr->itemCount; ++i) {
+			const char *name = pos + sizeof(int32_t);
+			const size_t nameLen = name < end ? strnlen(name, end - name) : 0;
+			if (name + nameLen >= end) {
+				LOG_CRT << "Invalid list data block, item " << i << " exceeds block size.";
+				return;
+			}
+			int32_t id;
+			memcpy(&id, pos, sizeof(int32_t));
+			listResult.result.emplace_back(id, string(name, nameLen));
+			pos = name + nameLen + 1;
+		}
+	}
+
 #pragma endregion
 #pragma region  Server-side logging commands  ----------------------------------------------
 
@@ -910,8 +1148,12 @@ class WASimClient::Private
 	}
 
 	void updateServerLogLevel(LogFacility fac = LogFacility::Remote) {
-		if (checkInit() && (!(+fac & +LogFacility::Remote) || SUCCEEDED(registerLogDataArea())))
-			sendServerCommand(Command(CommandId::Log, +settings.logLevel(LogSource::Server, fac), nullptr, (double)fac));
+		if (!checkInit() || ((+fac & +LogFacility::Remote) && FAILED(registerLogDataArea())))
+			return;
+		sendServerCommand(Command(CommandId::Log, +settings.logLevel(LogSource::Server, fac), nullptr, (double)fac));
+		// have the server send log records in batches if we could set up the data area for them
+		if ((+fac & +LogFacility::Remote) && logDataCDAcreated)
+			sendClientOption(ClientOption::PackedLogRecords, 1.0, false);
 	}
 
 	HRESULT registerLogDataArea() {
@@ -925,9 +1167,44 @@ class WASimClient::Private
 												(SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_LOG, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL);
 		}
 		logCDAcreated = SUCCEEDED(hr);
+		if (logCDAcreated && SUCCEEDED(registerDataArea(CDA_NAME_LOGDATA_PFX, CLI_DATA_LOGDATA, CLI_DATA_LOGDATA, LOG_DATA_AREA_SIZE, false))) {
+			// packed log records area is optional, the server uses the regular log area if this fails
+			logDataCDAcreated = SUCCEEDED(INVOKE_SIMCONNECT(RequestClientData, hSim, (SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_LOGDATA, (SIMCONNECT_DATA_REQUEST_ID)DATA_REQ_LOGDATA,
+			                                                (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_LOGDATA, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL));
+		}
 		return hr;
 	}
 
+	// Unpacks a batch of server log records from the log data area, see LogDataHeader for format.
+	void onLogData(const uint8_t *data, size_t dataSize)
+	{
+		if (dataSize < sizeof(LogDataHeader)) {
+			LOG_CRT << "Invalid log data block size! Expected at least " << sizeof(LogDataHeader) << " but got " << dataSize;
+			return;
+		}
+		const LogDataHeader *const hdr = reinterpret_cast<const LogDataHeader *const>(data);
+		if (hdr->dataSize > dataSize - sizeof(LogDataHeader)) {
+			LOG_CRT << "Invalid log data block " << hdr->sequence << " size! Reported size " << hdr->dataSize << " exceeds available " << dataSize - sizeof(LogDataHeader);
+			return;
+		}
+		const uint8_t *pos = data + sizeof(LogDataHeader);
+		const uint8_t *const end = pos + hdr->dataSize;
+		for (uint16_t i = 0; i < hdr->recordCount; ++i) {
+			const LogDataRecord *const rec = reinterpret_cast<const LogDataRecord *const>(pos);
+			if (pos + sizeof(LogDataRecord) > end || pos + sizeof(LogDataRecord) + rec->messageSize > end || !rec->messageSize) {
+				LOG_CRT << "Invalid log data block " << hdr->sequence << ", record " << i << " exceeds block size.";
+				return;
+			}
+			pos += sizeof(LogDataRecord);
+			LogRecord log(rec->level);
+			log.timestamp = rec->timestamp;
+			setCharArrayValue(log.message, std::min<size_t>(rec->messageSize, STRSZ_LOG), reinterpret_cast<const char *>(pos));
+			LOG_TRC << "Got Log Record: " << log;
+			invokeCallback(logCb, log, LogSource::Server);
+			pos += rec->messageSize;
+		}
+	}
+
 #pragma endregion
 #pragma region  Remote Variables accessors  ----------------------------------------------
 
@@ -1114,14 +1391,14 @@ class WASimClient::Private
 		if (isNewRequest || dataAllocChanged) {
 			if (isNewRequest) {
 				// Create & allocate the data area which will hold result value (server can write to this channel)
-				if FAILED(hr = registerDataArea(CDA_NAME_DATA_PFX + clientName + '.' + to_string(tr->requestId), tr->dataId, tr->dataId, tr->valueSize, false, true, max(tr->deltaEpsilon, 0.0f)))
+				if FAILED(hr = registerDataArea(CDA_NAME_DATA_PFX + clientName + '.' + to_string(tr->requestId), tr->dataId, tr->dataId, Utilities::getRequestDefinitionSize(*tr), false, true, max(tr->deltaEpsilon, 0.0f)))
 					return hr;
 			}
 			else if (dataAllocChanged) {
 				// remove definition, ignore errors (they will be logged)
 				deregisterDataRequestArea(tr);
 				// re-add definition, and now do not ignore errors
-				if FAILED(hr = SimConnectHelper::addClientDataDefinition(hSim, tr->dataId, tr->valueSize, max(tr->deltaEpsilon, 0.0f)))
+				if FAILED(hr = SimConnectHelper::addClientDataDefinition(hSim, tr->dataId, Utilities::getRequestDefinitionSize(*tr), max(tr->deltaEpsilon, 0.0f)))
 					return hr;
 			}
 		}
@@ -1146,18 +1423,36 @@ class WASimClient::Private
 		return SimConnectHelper::removeClientDataDefinition(hSim, tr->dataId);
 	}
 
-	HRESULT addOrUpdateRequest(const DataRequest &req, bool async)
+	// Calculates the record size of a Group type request from its member definitions. Returns 0 on error.
+	uint32_t getGroupRecordSize(const DataRequest &req)
+	{
+		vector<DataRequest> members;
+		bool bitmap;
+		string error;
+		if (!Utilities::parseGroupMembers(req, members, bitmap, error)) {
+			LOG_ERR << "Error in DataRequest ID: " << req.requestId << "; " << error;
+			return 0;
+		}
+		return Utilities::getGroupRecordSize(members, bitmap);
+	}
+
+	HRESULT addOrUpdateRequest(const DataRequest &request, bool async)
 	{
-		if (req.requestType == RequestType::None)
-			return removeRequest(req.requestId);
+		if (request.requestType == RequestType::None)
+			return removeRequest(request.requestId);
 
 		// preliminary validation
-		if (req.nameOrCode[0] == '\0') {
-			LOG_ERR << "Error in DataRequest ID: " << req.requestId << "; Parameter 'nameOrCode' cannot be empty.";
+		if (request.nameOrCode[0] == '\0') {
+			LOG_ERR << "Error in DataRequest ID: " << request.requestId << "; Parameter 'nameOrCode' cannot be empty.";
 			return E_INVALIDARG;
 		}
 
-		const uint32_t actualValSize = Utilities::getActualValueSize(req.valueSize);
+		// a Group request with no value size gets the size of the record holding all its members
+		DataRequest req(request);
+		if (req.requestType == RequestType::Group && !req.valueSize && !(req.valueSize = getGroupRecordSize(req)))
+			return E_INVALIDARG;
+
+		const uint32_t actualValSize = Utilities::getRequestDataSize(req);
 		if (actualValSize > SIMCONNECT_CLIENTDATA_MAX_SIZE) {
 			LOG_ERR << "Error in DataRequest ID: " << req.requestId << "; Value size " << actualValSize << " exceeds SimConnect maximum size " << SIMCONNECT_CLIENTDATA_MAX_SIZE;
 			return E_INVALIDARG;
@@ -1229,6 +1524,111 @@ class WASimClient::Private
 		return S_OK;
 	}
 
+	// Stores the value data for a request and notifies the data callback. Used for both individual request data areas and packed data updates.
+	void updateRequestData(uint32_t requestId, const void *data, size_t dataSize)
+	{
+		TrackedRequest *tr = findRequest(requestId);
+		if (!tr){
+			LOG_WRN << "DataRequest ID " << requestId << " not found in tracked requests.";
+			return;
+		}
+		// be paranoid; note that the reported pData->dwSize is never less than 4 bytes.
+		if (dataSize < tr->dataSize) {
+			LOG_CRT << "Invalid data result size! Expected " << tr->dataSize << " but got " << dataSize;
+			return;
+		}
+		unique_lock datalock(tr->m_dataMutex);
+		memcpy(tr->data.data(), data, tr->dataSize);
+		tr->lastUpdate = chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+		datalock.unlock();
+		shared_lock rdlock(mtxRequests);
+		LOG_TRC << "Got data result for request: " << *tr;
+		invokeCallback(dataCb, tr->toRequestRecord());
+	}
+
+	// Unpacks a block of value updates from the packed data area, see PackedDataHeader for format.
+	void onPackedData(const uint8_t *data, size_t dataSize)
+	{
+		if (dataSize < sizeof(PackedDataHeader)) {
+			LOG_CRT << "Invalid packed data block size! Expected at least " << sizeof(PackedDataHeader) << " but got " << dataSize;
+			return;
+		}
+		const PackedDataHeader *const hdr = reinterpret_cast<const PackedDataHeader *const>(data);
+		if (hdr->dataSize > dataSize - sizeof(PackedDataHeader)) {
+			LOG_CRT << "Invalid packed data block " << hdr->sequence << " size! Reported size " << hdr->dataSize << " exceeds available " << dataSize - sizeof(PackedDataHeader);
+			return;
+		}
+		LOG_TRC << "Got packed data block " << hdr->sequence << " with " << hdr->recordCount << " records of total size " << hdr->dataSize;
+		const uint8_t *pos = data + sizeof(PackedDataHeader);
+		const uint8_t *const end = pos + hdr->dataSize;
+		for (uint16_t i = 0; i < hdr->recordCount; ++i) {
+			const PackedDataRecord *const rec = reinterpret_cast<const PackedDataRecord *const>(pos);
+			if (pos + sizeof(PackedDataRecord) > end || pos + sizeof(PackedDataRecord) + rec->dataSize > end) {
+				LOG_CRT << "Invalid packed data block " << hdr->sequence << ", record " << i << " exceeds block size.";
+				return;
+			}
+			pos += sizeof(PackedDataRecord);
+			updateRequestData(rec->requestId, pos, rec->dataSize);
+			pos += rec->dataSize;
+		}
+	}
+
+	HRESULT registerListDataArea()
+	{
+		if (listCDAcreated)
+			return S_OK;
+		HRESULT hr;
+		// register list data area for reading; server can write to this channel
+		if SUCCEEDED(hr = registerDataArea(CDA_NAME_LIST_PFX, CLI_DATA_LIST, CLI_DATA_LIST, LIST_DATA_AREA_SIZE, false)) {
+			// start listening on the list data channel
+			hr = INVOKE_SIMCONNECT(RequestClientData, hSim, (SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_LIST, (SIMCONNECT_DATA_REQUEST_ID)DATA_REQ_LIST,
+			                       (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_LIST, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL);
+		}
+		listCDAcreated = SUCCEEDED(hr);
+		return hr;
+	}
+
+	HRESULT registerPackedDataArea()
+	{
+		if (packedCDAcreated)
+			return S_OK;
+		HRESULT hr;
+		// register packed data area for reading; server can write to this channel
+		if SUCCEEDED(hr = registerDataArea(CDA_NAME_PACKED_PFX, CLI_DATA_PACKED, CLI_DATA_PACKED, PACKED_DATA_AREA_SIZE, false)) {
+			// start listening on the packed data channel
+			hr = INVOKE_SIMCONNECT(RequestClientData, hSim, (SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_PACKED, (SIMCONNECT_DATA_REQUEST_ID)DATA_REQ_PACKED,
+			                       (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_PACKED, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL);
+		}
+		packedCDAcreated = SUCCEEDED(hr);
+		return hr;
+	}
+
+	// Sends a Client option setting to server, optionally waiting for the response.
+	HRESULT sendClientOption(ClientOption option, double value, bool waitResponse)
+	{
+		Command cmd(CommandId::Option, +option, nullptr, value);
+		if (!waitResponse)
+			return sendServerCommand(cmd);
+		HRESULT hr;
+		Command response;
+		if FAILED(hr = sendCommandWithResponse(move(cmd), &response))
+			return hr;
+		if (response.commandId != CommandId::Ack) {
+			LOG_WRN << "Server returned Nak for " << Utilities::getEnumName(option, ClientOptionNames) << " option, reason: " << quoted(response.sData);
+			return E_FAIL;
+		}
+		return S_OK;
+	}
+
+	// Sends the current packed data updates setting to server, creating the data area first if needed. Optionally waits for the response.
+	HRESULT updateServerPackedDataUpdates(bool waitResponse)
+	{
+		HRESULT hr;
+		if (packedDataUpdates && FAILED(hr = registerPackedDataArea()))
+			return hr;
+		return sendClientOption(ClientOption::PackedDataUpdates, (packedDataUpdates ? 1.0 : 0.0), waitResponse);
+	}
+
 	// this (re)registers all saved data requests with the server (not SimConnect), or deletes any requests flagged for deletion while offline.
 	// called from connectServer()
 	void registerAllDataRequests()
@@ -1308,15 +1708,61 @@ class WASimClient::Private
 
 #pragma region Simulator Key Events -------------------------------------------
 
-	// Writes KeyEvent data to the corresponding CDA.
-	HRESULT writeKeyEvent(const KeyEvent &kev) const
+	// Writes local variable values to the setter stream area in blocks of up to SETTER_STREAM_MAX_RECORDS.
+	HRESULT writeSetterStream(const SetterStreamRecord *records, size_t count) const
+	{
+		if (!isConnected()) {
+			LOG_ERR << "Server not connected, cannot stream variable values.";
+			return E_NOT_CONNECTED;
+		}
+		HRESULT hr = S_OK;
+		uint8_t block[SETTER_STREAM_AREA_SIZE] {};
+		while (count && SUCCEEDED(hr)) {
+			const SetterStreamHeader hdr { (uint32_t)std::min<size_t>(count, SETTER_STREAM_MAX_RECORDS), 0 };
+			memcpy(block, &hdr, sizeof(SetterStreamHeader));
+			memcpy(block + sizeof(SetterStreamHeader), records, hdr.recordCount * sizeof(SetterStreamRecord));
+			LOG_TRC << "Streaming " << hdr.recordCount << " variable values.";
+			hr = INVOKE_SIMCONNECT(SetClientData, hSim, (SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_SETTER, (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_SETTER, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL, (DWORD)SETTER_STREAM_AREA_SIZE, (void *)block);
+			records += hdr.recordCount;
+			count -= hdr.recordCount;
+		}
+		return hr;
+	}
+
+	// Writes KeyEvents to the server. If the server supports the key event queue, up to KEY_EVENT_QUEUE_SIZE events are added to the queue ring buffer
+	// and the whole queue is written to the corresponding CDA at once (see KeyEventQueueHeader for details). Otherwise each event is written to the single KeyEvent CDA.
+	HRESULT writeKeyEvents(const KeyEvent *events, size_t count)
 	{
 		if (!isConnected()) {
-			LOG_ERR << "Server not connected, cannot send " << kev;
+			LOG_ERR << "Server not connected, cannot send " << count << " key event(s).";
 			return E_NOT_CONNECTED;
 		}
-		LOG_TRC << "Sending: " << kev;
-		return INVOKE_SIMCONNECT(SetClientData, hSim, (SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_KEYEVENT, (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_KEYEVENT, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL, (DWORD)sizeof(KeyEvent), (void *)&kev);
+		HRESULT hr = S_OK;
+		if (!keyEventQueueEnabled) {
+			for (size_t i = 0; i < count && SUCCEEDED(hr); ++i) {
+				LOG_TRC << "Sending: " << events[i];
+				hr = INVOKE_SIMCONNECT(SetClientData, hSim, (SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_KEYEVENT, (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_KEYEVENT, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL, (DWORD)sizeof(KeyEvent), (void *)&events[i]);
+			}
+			return hr;
+		}
+		lock_guard lock(keyEventQueue.mutex);
+		while (count && SUCCEEDED(hr)) {
+			// more events than the queue holds would overwrite each other before the server could read them
+			const size_t n = std::min<size_t>(count, KEY_EVENT_QUEUE_SIZE);
+			for (size_t i = 0; i < n; ++i) {
+				const uint32_t seq = ++keyEventQueue.header()->writeSequence;
+				keyEventQueue.slots()[(seq - 1) % KEY_EVENT_QUEUE_SIZE] = events[i];
+				LOG_TRC << "Sending: " << events[i] << " with queue sequence " << seq;
+			}
+			hr = INVOKE_SIMCONNECT(SetClientData, hSim, (SIMCONNECT_CLIENT_DATA_ID)CLI_DATA_KEYQUEUE, (SIMCONNECT_CLIENT_DATA_DEFINITION_ID)CLI_DATA_KEYQUEUE, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL, (DWORD)KEY_EVENT_QUEUE_AREA_SIZE, (void *)keyEventQueue.block);
+			events += n;
+			count -= n;
+		}
+		return hr;
+	}
+
+	HRESULT writeKeyEvent(const KeyEvent &kev) {
+		return writeKeyEvents(&kev, 1);
 	}
 
 	// Custom Events
@@ -1483,6 +1929,20 @@ class WASimClient::Private
 								break;
 							}
 
+							// incoming statistics records, one at a time until Ack of Stats command.
+							case CommandId::Stats: {
+								lock_guard lock(statsResult.mutex);
+								if (statsResult.pending && cmd->token == statsResult.token) {
+									StatsRecord &rec = statsResult.result.emplace_back();
+									memcpy(&rec, cmd->sData, sizeof(StatsRecord));
+								}
+								else {
+									LOG_WRN << "Received unexpected stats result for token " << cmd->token;
+								}
+								checkTracking = false;
+								break;
+							}
+
 							// Server is disconnecting (shutting down/etc).
 							case CommandId::Disconnect:
 								disconnectServer(false);
@@ -1529,26 +1989,26 @@ class WASimClient::Private
 						break;
 					}  // DATA_REQ_LOG
 
+					case DATA_REQ_LOGDATA:
+						onLogData(reinterpret_cast<const uint8_t *>(&data->dwData), dataSize);
+						break;
+
+					case DATA_REQ_LIST:
+						onListData(reinterpret_cast<const uint8_t *>(&data->dwData), dataSize);
+						break;
+
+					case DATA_REQ_BATCHRES:
+						onBatchResults(reinterpret_cast<const uint8_t *>(&data->dwData), dataSize);
+						break;
+
+					case DATA_REQ_PACKED:
+						onPackedData(reinterpret_cast<const uint8_t *>(&data->dwData), dataSize);
+						break;
+
 					// possible request data
 					default:
 						if (data->dwRequestID >= SIMCONNECTID_LAST) {
-							TrackedRequest *tr = findRequest(data->dwRequestID - SIMCONNECTID_LAST);
-							if (!tr){
-								LOG_WRN << "DataRequest ID " << data->dwRequestID - SIMCONNECTID_LAST << " not found in tracked requests.";
-								return;
-							}
-							// be paranoid; note that the reported pData->dwSize is never less than 4 bytes.
-							if (dataSize < tr->dataSize) {
-								LOG_CRT << "Invalid data result size! Expected " << tr->dataSize << " but got " << dataSize;
-								return;
-							}
-							unique_lock datalock(tr->m_dataMutex);
-							memcpy(tr->data.data(), (void*)&data->dwData, tr->dataSize);
-							tr->lastUpdate = chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
-							datalock.unlock();
-							shared_lock rdlock(mtxRequests);
-							LOG_TRC << "Got data result for request: " << *tr;
-							invokeCallback(dataCb, tr->toRequestRecord());
+							updateRequestData(data->dwRequestID - SIMCONNECTID_LAST, (void*)&data->dwData, dataSize);
 							break;
 						}
 						LOG_WRN << "Got unknown RequestID in SIMCONNECT_RECV_CLIENT_DATA struct: " << data->dwRequestID;
@@ -1739,6 +2199,25 @@ HRESULT WASimClient::setOrCreateLocalVariable(const std::string &variableName, c
 	return d->setLocalVariable(VariableRequest(variableName, true, unitName), value);
 }
 
+HRESULT WASimClient::streamLocalVariable(int32_t variableId, double value, int32_t unitId) const
+{
+	if (variableId < 0)
+		return E_INVALIDARG;
+	const SetterStreamRecord rec { variableId, unitId, value };
+	return d_const->writeSetterStream(&rec, 1);
+}
+
+HRESULT WASimClient::streamLocalVariables(const std::vector<SetterStreamRecord> &values) const
+{
+	if (values.empty())
+		return E_INVALIDARG;
+	for (const SetterStreamRecord &rec : values) {
+		if (rec.variableId < 0)
+			return E_INVALIDARG;
+	}
+	return d_const->writeSetterStream(values.data(), values.size());
+}
+
 #pragma endregion
 
 #pragma region Data Requests ----------------------------------------------
@@ -1804,6 +2283,47 @@ HRESULT WASimClient::setDataRequestsPaused(bool paused) const {
 	return S_OK;
 }
 
+HRESULT WASimClient::setPackedDataUpdates(bool enable)
+{
+	const bool prev = d->packedDataUpdates.exchange(enable);
+	if (!isConnected() || prev == enable)
+		return S_OK;
+	const HRESULT hr = d->updateServerPackedDataUpdates(true);
+	if FAILED(hr)
+		d->packedDataUpdates = prev;
+	return hr;
+}
+
+bool WASimClient::packedDataUpdates() const { return d_const->packedDataUpdates; }
+
+HRESULT WASimClient::setDataUpdateHeartbeat(uint32_t intervalMs)
+{
+	const uint32_t prev = d->updateHeartbeat.exchange(intervalMs);
+	if (!isConnected() || prev == intervalMs)
+		return S_OK;
+	const HRESULT hr = d->sendClientOption(ClientOption::UpdateHeartbeat, intervalMs, true);
+	if FAILED(hr)
+		d->updateHeartbeat = prev;
+	return hr;
+}
+
+uint32_t WASimClient::dataUpdateHeartbeat() const { return d_const->updateHeartbeat; }
+
+HRESULT WASimClient::setDeltaEpsilonHysteresis(float factor)
+{
+	if (factor < 0.0f)
+		return E_INVALIDARG;
+	const float prev = d->deltaHysteresis.exchange(factor);
+	if (!isConnected() || prev == factor)
+		return S_OK;
+	const HRESULT hr = d->sendClientOption(ClientOption::DeltaEpsilonHysteresis, factor, true);
+	if FAILED(hr)
+		d->deltaHysteresis = prev;
+	return hr;
+}
+
+float WASimClient::deltaEpsilonHysteresis() const { return d_const->deltaHysteresis; }
+
 #pragma endregion Data
 
 #pragma region Calculator Events ----------------------------------------------
@@ -1895,11 +2415,54 @@ vector<RegisteredEvent> WASimClient::registeredEvents() const
 HRESULT WASimClient::sendKeyEvent(uint32_t keyEventId, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5) const
 {
 	if (keyEventId < CUSTOM_KEY_EVENT_ID_MIN)
-		return d_const->writeKeyEvent(KeyEvent(keyEventId, { v1, v2, v3, v4, v5 }, d->nextCmdToken++));
+		return d->writeKeyEvent(KeyEvent(keyEventId, { v1, v2, v3, v4, v5 }, d->nextCmdToken++));
 	else
 		return d_const->sendSimCustomKeyEvent(keyEventId, v1, v2, v3, v4, v5);
 }
 
+HRESULT WASimClient::sendKeyEvents(const std::vector<KeyEvent> &events) const
+{
+	if (events.empty())
+		return E_INVALIDARG;
+	vector<KeyEvent> kevs(events);
+	for (KeyEvent &kev : kevs) {
+		if (!kev.eventId || kev.eventId >= CUSTOM_KEY_EVENT_ID_MIN)
+			return E_INVALIDARG;
+		if (!kev.token)
+			kev.token = d->nextCmdToken++;
+	}
+	return d->writeKeyEvents(kevs.data(), kevs.size());
+}
+
+HRESULT WASimClient::setKeyEventCoalescing(uint32_t keyEventId, bool coalesce)
+{
+	if (!keyEventId || keyEventId >= CUSTOM_KEY_EVENT_ID_MIN)
+		return E_INVALIDARG;
+	{
+		unique_lock lock(d->mtxCoalescedKeyEvents);
+		const bool changed = coalesce ? d->coalescedKeyEventIds.insert(keyEventId).second : d->coalescedKeyEventIds.erase(keyEventId) > 0;
+		if (!changed)
+			return S_OK;
+	}
+	if (!isConnected())
+		return S_OK;
+	const HRESULT hr = d->sendClientOption(ClientOption::CoalesceKeyEvent, (coalesce ? 1.0 : -1.0) * keyEventId, true);
+	if FAILED(hr) {
+		unique_lock lock(d->mtxCoalescedKeyEvents);
+		if (coalesce)
+			d->coalescedKeyEventIds.erase(keyEventId);
+		else
+			d->coalescedKeyEventIds.insert(keyEventId);
+	}
+	return hr;
+}
+
+bool WASimClient::keyEventCoalescing(uint32_t keyEventId) const
+{
+	shared_lock lock(d_const->mtxCoalescedKeyEvents);
+	return d_const->coalescedKeyEventIds.count(keyEventId) > 0;
+}
+
 inline static bool isCustomKeyEventName(const std::string &name) {
 	return name[0] == '#' || name.find('.') != string::npos;
 }
@@ -1972,7 +2535,11 @@ HRESULT WASimClient::removeCustomKeyEvent(const std::string &customEventName)
 
 #pragma region Meta Data ----------------------------------------------
 
-HRESULT WASimClient::list(LookupItemType itemsType)
+HRESULT WASimClient::list(LookupItemType itemsType) {
+	return list(itemsType, 0, 0);
+}
+
+HRESULT WASimClient::list(LookupItemType itemsType, uint32_t startIndex, uint32_t count)
 {
 	// validation
 	static const set<LookupItemType> validListLookups { LookupItemType::LocalVariable, LookupItemType::DataRequest, LookupItemType::RegisteredEvent };
@@ -1989,7 +2556,11 @@ HRESULT WASimClient::list(LookupItemType itemsType)
 	d->listResult.listType = itemsType;
 	d->listResult.nextTimeout = Clock::now() + chrono::milliseconds(defaultTimeout());
 	HRESULT hr;
-	if FAILED(hr = d->sendServerCommand(Command(CommandId::List, +itemsType), weak_ptr(d->listResult.cv), &d->listResult.token))
+	// request packed results if the list data area is available; older servers ignore this and send individual results
+	const double packed = SUCCEEDED(d->registerListDataArea()) ? 1.0 : 0.0;
+	// optional range of items as "<start>,<count>"
+	const string range = (startIndex || count) ? to_string(startIndex) + ',' + to_string(count) : string();
+	if FAILED(hr = d->sendServerCommand(Command(CommandId::List, +itemsType, range.c_str(), packed), weak_ptr(d->listResult.cv), &d->listResult.token))
 		return hr;
 	lock.unlock();
 	try {
@@ -2032,6 +2603,42 @@ HRESULT WASimClient::lookup(LookupItemType itemType, const std::string &itemName
 	return hr;
 }
 
+HRESULT WASimClient::serverStats(std::vector<StatsRecord> *stats, bool resetCounters, bool allClients)
+{
+	if (!stats)
+		return E_INVALIDARG;
+	if (d->statsResult.pending.exchange(true)) {
+		LOG_ERR << "A Stats request is currently pending.";
+		return E_INVALIDARG;
+	}
+	HRESULT hr;
+	uint32_t token;
+	shared_ptr<condition_variable_any> cv = make_shared<condition_variable_any>();
+	unique_lock lock(d->statsResult.mutex);
+	d->statsResult.result.clear();
+	// the token needs to be set before any results arrive, which are blocked by the lock until then
+	if SUCCEEDED(hr = d->sendServerCommand(Command(CommandId::Stats, (resetCounters ? 1 : 0), nullptr, (allClients ? 1.0 : 0.0)), weak_ptr(cv), &token))
+		d->statsResult.token = token;
+	lock.unlock();
+	if (SUCCEEDED(hr)) {
+		// the results are all received before the final Ack
+		Command response;
+		if FAILED(hr = d->waitCommandResponse(token, &response))
+			LOG_ERR << "Stats request timed out.";
+		else if (response.commandId != CommandId::Ack) {
+			LOG_WRN << "Stats command returned Nak response. Reason, if any: " << quoted(response.sData);
+			hr = E_FAIL;
+		}
+	}
+	lock.lock();
+	if (SUCCEEDED(hr))
+		*stats = move(d->statsResult.result);
+	d->statsResult.result.clear();
+	d->statsResult.token = 0;
+	d->statsResult.pending = false;
+	return hr;
+}
+
 #pragma endregion Meta
 
 #pragma region Low Level ----------------------------------------------
@@ -2044,6 +2651,28 @@ HRESULT WASimClient::sendCommandWithResponse(const Command &command, Command *re
 	return d->sendCommandWithResponse(Command(command), response, timeout);
 }
 
+HRESULT WASimClient::setSuppressCommandAcks(bool suppress)
+{
+	const bool prev = d->suppressAcks.exchange(suppress);
+	if (!isConnected() || prev == suppress)
+		return S_OK;
+	const HRESULT hr = d->sendClientOption(ClientOption::SuppressAcks, (suppress ? 1.0 : 0.0), true);
+	if FAILED(hr)
+		d->suppressAcks = prev;
+	return hr;
+}
+
+bool WASimClient::suppressCommandAcks() const { return d_const->suppressAcks; }
+
+HRESULT WASimClient::sendCommands(const std::vector<Command> &commands, std::vector<Command> *responses, uint32_t timeout)
+{
+	if (commands.empty())
+		return E_INVALIDARG;
+	if (responses)
+		responses->clear();
+	return d->sendCommandBatches(commands, responses, timeout);
+}
+
 #pragma endregion Low Level
 
 #pragma region Status / Network / Logging / Callbacks ----------------------------------------------
@@ -205,6 +205,48 @@ namespace WASimCommander::CLI::Structs
 	};
 
 
+	/// <summary> Performance statistics of a Client or one of its Data Requests, as collected by the server. \sa WASimCommander:CommandId::Stats command. </summary>
+	/// For full documentation of each field see `WASimCommander::StatsRecord`.  \since v1.4.0
+	[StructLayout(LayoutKind::Sequential, CharSet = CharSet::Ansi, Pack = 1)]
+	public ref struct StatsRecord sealed
+	{
+		public:
+			UInt32 clientId;
+			UInt32 requestId;
+			UInt64 evalCount;
+			UInt64 evalTimeTotal;
+			UInt32 evalTimeMax;
+			UInt32 commandTimeMax;
+			UInt64 writeCount;
+			UInt64 suppressedCount;
+			UInt64 commandCount;
+			UInt64 commandTimeTotal;
+			UInt64 throttledCount;
+			UInt64 updateCount;
+			UInt64 updateLagTotal;
+			UInt32 updateLagMax;
+			UInt32 lateCount;
+			UInt64 keyEventCount;
+			UInt64 coalescedCount;
+
+			String ^ToString() override {
+				return String::Format(
+					"StatsRecord {{client: {0:X}; request: {1}; evals: {2}; evalTime: {3}us; evalMax: {4}us; writes: {5}; suppressed: {6}; commands: {7}; cmdTime: {8}us; cmdMax: {9}us; throttled: {10}; "
+					"updates: {11}; lag: {12}us; lagMax: {13}us; late: {14}; keyEvents: {15}; coalesced: {16}}}",
+					clientId, (Int32)requestId, evalCount, evalTimeTotal, evalTimeMax, writeCount, suppressedCount, commandCount, commandTimeTotal, commandTimeMax, throttledCount,
+					updateCount, updateLagTotal, updateLagMax, lateCount, keyEventCount, coalescedCount
+				);
+			}
+
+		internal:
+			explicit StatsRecord(const WASimCommander::StatsRecord &sr)
+			{
+				pin_ptr<UInt32> ptr = &this->clientId;
+				memcpy_s(ptr, Marshal::SizeOf(this), &sr, sizeof(WASimCommander::StatsRecord));
+			}
+	};
+
+
 	/// <summary> Structure for value update subscription requests. \sa WASimCommander:CommandId::Subscribe command. </summary>
 	/// For full documentation of each field see `WASimCommander::DataRequest`.
 	[StructLayout(LayoutKind::Sequential, CharSet = CharSet::Ansi, Pack = 1)]
@@ -221,6 +263,10 @@ namespace WASimCommander::CLI::Structs
 			Byte simVarIndex {0};
 			SByte varTypePrefix {'L'};
 			char_array<STRSZ_REQ> nameOrCode;
+			UInt16 minUpdateInterval {0};
+			UInt16 maxUpdateInterval {0};
+			RequestPriority priority {RequestPriority::Normal};
+			Byte simVarIndexCount {0};
 			char_array<STRSZ_UNIT> unitName;
 
 			/// <summary> Default constructor. Properties must be set to valid values, either later or inline, eg. `new DataRequest() { requestId: 1, requestType: RequestType::Named, ...}`. </summary>
@@ -295,8 +341,14 @@ namespace WASimCommander::CLI::Structs
 				Text::StringBuilder sb(str);
 				if (requestType == RequestType::None)
 					return sb.Append("; type: None; }")->ToString();
-				if (requestType == RequestType::Named)
-					return sb.AppendFormat("; type: Named; name: \"{0}\"; unit: \"{1}\"; varType: '{2}'; varIndex: {3}}}", nameOrCode, unitName, varTypePrefix, simVarIndex)->ToString();
+				if (requestType == RequestType::Named) {
+					sb.AppendFormat("; type: Named; name: \"{0}\"; unit: \"{1}\"; varType: '{2}'; varIndex: {3}", nameOrCode, unitName, varTypePrefix, simVarIndex);
+					if (simVarIndexCount > 1)
+						sb.AppendFormat("; varIndexCount: {0}", simVarIndexCount);
+					return sb.Append("}")->ToString();
+				}
+				if (requestType == RequestType::Group)
+					return sb.AppendFormat("; type: Group; members: \"{0}\"}}", nameOrCode)->ToString();
 				return sb.AppendFormat("; type: Calculated; code: \"{0}\"; resultType: {1}}}", nameOrCode, calcResultType)->ToString();
 			}
 
@@ -382,6 +434,26 @@ namespace WASimCommander::CLI::Structs
 				return true;
 			}
 
+			/// <summary> Tries to populate an array of the desired type `T` with the values of an array result, such as from an indexed-range SimVar request (see `DataRequest::simVarIndexCount`),
+			/// and returns true or false depending on if the conversion was valid (meaning the data size is a non-zero multiple of the size of the requested type). </summary>
+			/// If the conversion fails, result is an empty array.
+			generic<typename T>
+#if !DOXYGEN
+			where T : value class, gcnew()
+#endif
+			inline bool tryConvertArray([Out] array<T> ^ %result)
+			{
+				if (!data->Length || data->Length % (int)sizeof(T)) {
+					result = gcnew array<T>(0);
+					return false;
+				}
+				result = gcnew array<T>(data->Length / (int)sizeof(T));
+				pin_ptr<T> pr = &result[0];
+				pin_ptr<Byte> pd = &data[0];
+				memcpy_s(pr, data->Length, pd, data->Length);
+				return true;
+			}
+
 			/// \name Implicit conversion operators for various types.
 			/// \{
 			inline static operator double(DataRequestRecord ^dr) { return dr->toType<double>(); }
@@ -278,6 +278,32 @@ inline array<RegisteredEvent^>^ WASimClient::registeredEvents()
 	return ret;
 }
 
+inline HR WASimClient::serverStats(array<StatsRecord ^> ^%stats, bool resetCounters, bool allClients)
+{
+	std::vector<WASimCommander::StatsRecord> res;
+	const HR hr = (HR)m_client->serverStats(&res, resetCounters, allClients);
+	stats = gcnew array<StatsRecord ^>((int)res.size());
+	int i = 0;
+	for (const auto &sr : res)
+		stats[i++] = gcnew StatsRecord(sr);
+	return hr;
+}
+
+inline HR WASimClient::sendCommands(array<Command ^> ^commands, array<Command ^> ^%responses, Nullable<uint32_t> timeout)
+{
+	std::vector<WASimCommander::Command> cmds;
+	cmds.reserve(commands->Length);
+	for (int i = 0; i < commands->Length; ++i)
+		cmds.push_back(commands[i]);
+	std::vector<WASimCommander::Command> res;
+	const HR hr = (HR)m_client->sendCommands(cmds, &res, (timeout.HasValue ? timeout.Value : 0));
+	responses = gcnew array<Command ^>((int)res.size());
+	int i = 0;
+	for (const auto &r : res)
+		responses[i++] = gcnew Command(r);
+	return hr;
+}
+
 #define DELEGATE_HANDLER(E, D, H)      \
 		void WASimClient::E::add(D ^ h) { H += h; }     \
 		void WASimClient::E::remove(D ^ h) { H -= h; }
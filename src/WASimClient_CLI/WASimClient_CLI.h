@@ -199,6 +199,10 @@ namespace WASimCommander::CLI::Client
 		HR setOrCreateLocalVariable(String ^variableName, String ^unitName, const double value) {
 			return (HR)m_client->setOrCreateLocalVariable(marshal_as<std::string>(variableName), value, marshal_as<std::string>(unitName));
 		}
+		/// See \refwccc{streamLocalVariable()}
+		HR streamLocalVariable(int32_t variableId, double value) { return (HR)m_client->streamLocalVariable(variableId, value); }
+		/// See \refwccc{streamLocalVariable()}
+		HR streamLocalVariable(int32_t variableId, double value, int32_t unitId) { return (HR)m_client->streamLocalVariable(variableId, value, unitId); }
 
 		/// See \refwccc{setSimVarVariable(const std::string &, const std::string &, double)}
 		HR setSimVarVariable(String ^variableName, String ^unitName, const double value) {
@@ -231,6 +235,12 @@ namespace WASimCommander::CLI::Client
 		array<UInt32> ^dataRequestIdsList();  ///< See \refwccc{dataRequestIdsList()}
 
 		HR setDataRequestsPaused(bool paused) { return (HR)m_client->setDataRequestsPaused(paused); }  ///< See \refwccc{setDataRequestsPaused()}
+		HR setPackedDataUpdates(bool enable) { return (HR)m_client->setPackedDataUpdates(enable); }  ///< See \refwccc{setPackedDataUpdates()}
+		bool packedDataUpdates() { return m_client->packedDataUpdates(); }  ///< See \refwccc{packedDataUpdates()}
+		HR setDataUpdateHeartbeat(uint32_t intervalMs) { return (HR)m_client->setDataUpdateHeartbeat(intervalMs); }  ///< See \refwccc{setDataUpdateHeartbeat()}
+		uint32_t dataUpdateHeartbeat() { return m_client->dataUpdateHeartbeat(); }  ///< See \refwccc{dataUpdateHeartbeat()}
+		HR setDeltaEpsilonHysteresis(float factor) { return (HR)m_client->setDeltaEpsilonHysteresis(factor); }  ///< See \refwccc{setDeltaEpsilonHysteresis()}
+		float deltaEpsilonHysteresis() { return m_client->deltaEpsilonHysteresis(); }  ///< See \refwccc{deltaEpsilonHysteresis()}
 
 		/// \}
 		/// \name RPN calculator code execution and reusable events
@@ -256,6 +266,9 @@ namespace WASimCommander::CLI::Client
 		HR sendKeyEvent(String ^keyEventName, [Optional] Nullable<uint32_t> v1, [Optional] Nullable<uint32_t> v2, [Optional] Nullable<uint32_t> v3, [Optional] Nullable<uint32_t> v4, [Optional] Nullable<uint32_t> v5) {
 			return (HR)m_client->sendKeyEvent(marshal_as<std::string>(keyEventName), v1.GetValueOrDefault(0), v2.GetValueOrDefault(0), v3.GetValueOrDefault(0), v4.GetValueOrDefault(0), v5.GetValueOrDefault(0));
 		}
+		/// See \refwccc{setKeyEventCoalescing()}
+		HR setKeyEventCoalescing(uint32_t keyEventId, [Optional] Nullable<bool> coalesce) { return (HR)m_client->setKeyEventCoalescing(keyEventId, coalesce.GetValueOrDefault(true)); }
+		bool keyEventCoalescing(uint32_t keyEventId) { return m_client->keyEventCoalescing(keyEventId); }  ///< See \refwccc{keyEventCoalescing()}
 
 		/// See \refwccc{registerCustomKeyEvent()};
 		HR registerCustomKeyEvent(String ^customEventName, [Out] UInt32 %puiCustomEventId, [Optional] Nullable<bool> useLegacyTransmit) {
@@ -278,12 +291,20 @@ namespace WASimCommander::CLI::Client
 
 		/// See \refwccc{list()}
 		HR list(LookupItemType itemsType) { return (HR)m_client->list((WSE::LookupItemType)itemsType); }
+		/// See \refwccc{list()}
+		HR list(LookupItemType itemsType, UInt32 startIndex, UInt32 count) { return (HR)m_client->list((WSE::LookupItemType)itemsType, startIndex, count); }
 		/// See \refwccc{lookup()}
 		HR lookup(LookupItemType itemType, String ^itemName, [Out] Int32 %piResult)
 		{
 			pin_ptr<Int32> pi = &piResult;
 			return (HR)m_client->lookup((WSE::LookupItemType)itemType, marshal_as<std::string>(itemName), pi);
 		}
+		/// See \refwccc{serverStats()}
+		HR serverStats([Out] array<StatsRecord ^> ^%stats) { return serverStats(stats, false, false); }
+		/// See \refwccc{serverStats()}
+		HR serverStats([Out] array<StatsRecord ^> ^%stats, bool resetCounters) { return serverStats(stats, resetCounters, false); }
+		/// See \refwccc{serverStats()}
+		HR serverStats([Out] array<StatsRecord ^> ^%stats, bool resetCounters, bool allClients);
 
 		/// \}
 		/// \name Low level API
@@ -299,6 +320,10 @@ namespace WASimCommander::CLI::Client
 			response = gcnew Command(resp);
 			return (HR)hr;
 		}
+		/// See \refwccc{sendCommands()}
+		HR sendCommands(array<Command ^> ^commands, [Out] array<Command ^> ^%responses, [Optional] Nullable<uint32_t> timeout);
+		HR setSuppressCommandAcks(bool suppress) { return (HR)m_client->setSuppressCommandAcks(suppress); }  ///< See \refwccc{setSuppressCommandAcks()}
+		bool suppressCommandAcks() { return m_client->suppressCommandAcks(); }  ///< See \refwccc{suppressCommandAcks()}
 
 		/// \}
 		/// \name  Logging settings
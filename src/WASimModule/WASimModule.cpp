@@ -17,17 +17,22 @@ A copy of the GNU GPL is included with this project
 and is also available at <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <charconv>
 #include <iomanip>
 #include <iostream>
-#include <map>
+#include <limits>
+#include <list>
 #include <memory>
+#include <queue>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <unordered_map>
 
 // the order of includes below here matters (because the MSFS/SC headers are wonky)
 
@@ -65,6 +70,7 @@ enum SimConnectIDs : uint8_t
 	GROUP_DEFAULT,        // default notification group for all standard sim events
 	// SIMCONNECT_EVENT_ID
 	EVENT_FRAME,          // for frame event trigger
+	EVENT_AIRCRAFT_LOADED,  // for invalidating cached variable IDs
 	// SIMCONNECT_CLIENT_EVENT_ID
 	CLI_EVENT_CONNECT,    // initial client connection event
 	CLI_EVENT_PING,       // incoming ping event
@@ -79,7 +85,7 @@ enum class ClientStatus : uint8_t
 
 enum class RecordType : uint8_t
 {
-	Unknown, CommandData, RequestData, KeyEventData
+	Unknown, CommandData, RequestData, KeyEventData, CommandBatchData, SetterStreamData, KeyEventQueueData
 };
 #pragma endregion Enums
 
@@ -87,6 +93,34 @@ enum class RecordType : uint8_t
 #pragma region Struct and type definitions
 //----------------------------------------------------------------------------
 
+struct calcResult_t
+{
+	CalcResultType type;
+	size_t strSize;
+	int32_t varId = -1;
+	int32_t unitId = -1;
+	uint8_t varIndex = 0;
+	const char *varName = nullptr;
+	size_t resultSize = 0;
+	int8_t resultMemberIndex = -1;
+	FLOAT64 fVal = 0.0;
+	SINT32 iVal = 0;
+	string sVal {};
+	bool keepString = true;  // store the string result of calculator code even if a numeric result type was requested
+	void setF(const FLOAT64 val) { fVal = val; resultSize = sizeof(FLOAT64); resultMemberIndex = 0; }
+	void setI(const SINT32  val) { iVal = val; resultSize = sizeof(SINT32); resultMemberIndex = 1; }
+	// assigning to the existing string reuses its storage, so a re-used result does not allocate once it has held a string of `strSize`
+	void setS(const char *val, size_t len) { sVal.assign(val, len); sVal.resize(strSize); resultSize = strSize; resultMemberIndex = 2; }
+
+	// Prepares a re-used result for a new evaluation, keeping the string storage.
+	void reset(CalcResultType t, size_t sz, int32_t vId, int32_t uId, uint8_t vIdx, const char *vName, bool keepStr)
+	{
+		type = t; strSize = sz; varId = vId; unitId = uId; varIndex = vIdx; varName = vName; keepString = keepStr;
+		resultSize = 0; resultMemberIndex = -1; fVal = 0.0; iVal = 0;
+		sVal.clear();
+	}
+};
+
 // DataRequest tracking meta data
 struct TrackedRequest : DataRequest
 {
@@ -95,25 +129,40 @@ struct TrackedRequest : DataRequest
 	ID variableId = -1;        // result of local var name lookup
 	ENUM unitId = -1;          // result of unit name lookup
 	steady_clock::time_point nextUpdate = steady_clock::now();  // time of next pending value check/update
+	steady_clock::time_point lastWrite {};  // time the current value was last written to the client, for heartbeat and rate limited updates
+	uint64_t scheduleSeq = 0;  // sequence number of the currently valid entry in the update schedule queue, zero if not scheduled
 	vector<uint8_t> data {};   // the last data value is stored here, for comparison to detect value changes
 	string calcBytecode {};    // compiled calculator string byte code
 	bool compareCheck = true;  // indicates that a result value should be compared for equality with last value before sending update
+	bool dataValid = false;    // indicates that `data` holds a value which was actually sent to the client (as opposed to the initial fill)
+	bool pendingWrite = false; // a changed value is being held back until the request's minUpdateInterval has passed since the last write
+	int8_t lastDeltaSign = 0;  // direction of the last numeric change which was sent, for deltaEpsilon hysteresis
+	StatsRecord stats {};      // performance counters
+	calcResult_t result { CalcResultType::None, 0 };  // evaluation result buffer, re-used for each update
+	union { float f32; int32_t i32; int64_t i64; } convertedValue {};  // result value converted to a different numeric type than the result, see getRequestValueData()
+	vector<TrackedRequest> groupMembers {};  // member values of a Group type request, which have no data areas of their own; a member's last sent value is kept in the group record
+	TrackedRequest *group = nullptr;  // the Group type request which this is a member of, which gets the member's statistics
+	bool groupBitmap = false;  // the Group record starts with a bitmap of changed members
+	vector<uint8_t> rangeData {};  // evaluation buffer for the values of an indexed-range SimVar request
 
 	explicit TrackedRequest(const DataRequest &req, uint32_t dataId) :
 		DataRequest(req),
 		dataId{dataId},
-		dataSize{Utilities::getActualValueSize(req.valueSize)},
+		dataSize{Utilities::getRequestDataSize(req)},
 		data((size_t)dataSize, -1),
 		compareCheck{req.deltaEpsilon >= 0.0f}
 	{
+		stats.requestId = req.requestId;
 		checkRequestType();
 	}
 
 	TrackedRequest &operator=(const DataRequest &req) {
 		// reset data array size
-		if (!dataSize || req.valueSize != valueSize) {
-			dataSize = Utilities::getActualValueSize(req.valueSize);
+		if (!dataSize || req.valueSize != valueSize || req.simVarIndexCount != simVarIndexCount) {
+			dataSize = Utilities::getRequestDataSize(req);
 			data = vector<uint8_t>(dataSize, -1);
+			dataValid = false;
+			lastDeltaSign = 0;
 		}
 		// reset lookup data
 		if (strncmp(req.nameOrCode, nameOrCode, STRSZ_REQ)) {
@@ -166,10 +215,62 @@ struct TrackedEvent
 	string code {};
 	string name {};
 	string execCode {};    // actual code to exec, most likely bytecode
+	SIMCONNECT_CLIENT_EVENT_ID clientEventId = 0;  // SimConnect client event ID for triggering via TransmitClientEvent, zero if not mapped
+};
+
+// number of RequestPriority classes; due updates are collected and processed separately for each class
+static const size_t REQUEST_PRIORITY_CLASSES = 3;
+
+// returns the index of a request's priority class; requests with invalid priority values are rejected when added, but treat any as Normal priority anyway
+static inline size_t priorityClass(RequestPriority p) {
+	return (size_t)p < REQUEST_PRIORITY_CLASSES ? (size_t)p : (size_t)RequestPriority::Normal;
+}
+
+// An entry in the request update schedule queue. Entries are never removed from the queue directly; an entry is
+// considered stale when the referenced client or request no longer exists, or the request's `scheduleSeq` no longer matches.
+struct ScheduledUpdate
+{
+	steady_clock::time_point due;
+	uint64_t seq;
+	uint32_t clientId;
+	uint32_t requestId;
+	size_t priorityClass;  // index of request's priority class at the time it was scheduled
+	bool operator>(const ScheduledUpdate &other) const { return due > other.due; }
+};
+
+typedef unordered_map<uint32_t, TrackedRequest> requestMap_t;  // node based, so TrackedRequest pointers stay valid while other requests are added or removed
+typedef unordered_map<uint32_t, TrackedEvent> clientEventMap_t;
+typedef unordered_multimap<string, uint32_t> nameIndex_t;  // request names or event code strings to IDs (names may not be unique)
+
+// State of a List command in progress, which may be processed over several ticks.
+struct ListCursor
+{
+	bool active = false;       // true while L var list results are still being sent on subsequent ticks
+	bool packed = false;       // results are written to the list data area instead of individual List responses
+	uint32_t token = 0;        // token of the List command being processed
+	uint32_t start = 0;        // index of first item to send
+	uint32_t count = 0;        // maximum number of items to send, zero for all
+	uint32_t next = 0;         // index of next item to check
+	vector<uint8_t> block {};  // pending packed results block: ListDataHeader followed by items
 };
 
-typedef map<uint32_t, TrackedRequest> requestMap_t;
-typedef map<uint32_t, TrackedEvent> clientEventMap_t;
+// Log records waiting to be sent to a client, which are written in batches once per tick (or after each processed message) instead of as they are logged.
+struct LogQueue
+{
+	struct Entry {
+		time_t timestamp;
+		LogLevel level;
+		string message;
+	};
+	vector<Entry> ring {};     // bounded ring buffer of pending records, the oldest ones are dropped when it is full
+	size_t head = 0;           // index of oldest pending record
+	size_t count = 0;          // number of pending records
+	uint32_t dropped = 0;      // number of records dropped since the last batch was sent
+	bool sending = false;      // set while records are being written, to ignore any messages logged in the process
+	bool packed = false;       // write batches to the log data area (ClientOption::PackedLogRecords)
+	uint32_t sequence = 0;     // packed batch counter
+	vector<uint8_t> block {};  // packed batch being assembled: LogDataHeader followed by LogDataRecord + message text for each record
+};
 
 // WASim Client record
 struct Client
@@ -187,53 +288,194 @@ struct Client
 	DWORD cddID_request = 0;
 	DWORD cddID_log = 0;
 	DWORD cddID_keyEvent = 0;
+	DWORD cddID_packedData = 0;
+	DWORD cddID_listData = 0;
+	DWORD cddID_logData = 0;
+	DWORD cddID_commandBatch = 0;
+	DWORD cddID_batchResults = 0;
+	DWORD cddID_setterStream = 0;
+	DWORD cddID_keyEventQueue = 0;
+	uint32_t keyEventReadSeq = 0;  // sequence number of the last processed event from the key event queue
+	bool keyEventQueue = false;    // read key events from the key event queue area (ClientOption::KeyEventQueue)
+	vector<uint32_t> coalescedKeyEventIds {};  // key event IDs to coalesce (ClientOption::CoalesceKeyEvent)
+	vector<KeyEvent> coalescedKeyEvents {};  // latest pending coalescable key events, one per event ID and extra values, triggered on the next tick
 	// request and custom event tracking
 	requestMap_t requests {};
 	clientEventMap_t events {};
+	nameIndex_t requestNameIndex {};  // DataRequest nameOrCode to requestId
+	nameIndex_t eventCodeIndex {};    // TrackedEvent code to eventId
+	// packed data value updates (ClientOption::PackedDataUpdates)
+	bool packedDataUpdates = false;
+	uint32_t packedDataSeq = 0;
+	vector<uint8_t> packedData {};  // pending update block: PackedDataHeader followed by PackedDataRecord + value data for each record
+	// value change filtering (ClientOption::UpdateHeartbeat and ClientOption::DeltaEpsilonHysteresis)
+	steady_clock::duration updateHeartbeat { 0 };  // maximum time between value updates, even if unchanged; zero to disable
+	float deltaHysteresis = 0.0f;  // extra fraction of deltaEpsilon required to send a change in the opposite direction of the last one
+	bool suppressAcks = false;     // don't send Acks for successful commands which return no data (ClientOption::SuppressAcks)
+	StatsRecord stats {};  // performance counter totals
+	ListCursor listCursor {};  // current List command state
+	// per-tick update processing state, see tick()
+	vector<ScheduledUpdate> dueUpdates[REQUEST_PRIORITY_CLASSES] {};  // updates which are due on the current tick for each priority class, in order of due time
+	size_t dueNext[REQUEST_PRIORITY_CLASSES] {};  // index of next update in each of the `dueUpdates` lists to process
+	uint32_t tickUpdates = 0;  // number of request updates processed on the current tick
+	uint32_t tickBytes = 0;    // number of value data bytes written on the current tick
+	bool throttled = false;    // the per-client update or data size limit was reached on the current tick
+	LogQueue logQueue {};      // pending log records
 
 	Client(uint32_t id, ClientStatus status = ClientStatus::Connected) :
 		clientId(id),
 		name{(ostringstream() << STREAM_HEX8(id)).str()},
 		status(status)
-	{	}
+	{
+		stats.clientId = id;
+	}
 };
 
 struct DefinitionIdRecord
 {
-	const RecordType type;
-	Client *const client;
+	RecordType type = RecordType::Unknown;
+	Client *client = nullptr;  // null for unused records
+	DefinitionIdRecord() = default;
 	explicit DefinitionIdRecord(const RecordType t, Client * const c) : type(t), client(c) {}
 };
 
 struct EventIdRecord
 {
-	const uint32_t eventId;
-	Client *const client;
+	uint32_t eventId = 0;
+	Client *client = nullptr;  // null for unused records
+	EventIdRecord() = default;
 	explicit EventIdRecord(const uint32_t eId, Client * const c) : eventId(eId), client(c) {}
 };
 
-struct calcResult_t
+// Lookup table for records keyed by the sequential SimConnect IDs which the module assigns itself (starting at SIMCONNECTID_LAST).
+// Records are stored in a vector indexed directly by ID, so lookups in message dispatch need no searching.
+// IDs are never reused, so the table only grows; removed records are reset to their default (null client) state.
+template <typename T>
+struct IdRecordTable
 {
-	CalcResultType type;
-	size_t strSize;
-	int32_t varId = -1;
-	int32_t unitId = -1;
+	vector<T> records {};
+
+	const T *find(uint32_t id) const {
+		const uint32_t idx = id - SIMCONNECTID_LAST;
+		if (id < SIMCONNECTID_LAST || idx >= records.size() || !records[idx].client)
+			return nullptr;
+		return &records[idx];
+	}
+
+	void set(uint32_t id, const T &rec) {
+		if (id < SIMCONNECTID_LAST)
+			return;
+		const uint32_t idx = id - SIMCONNECTID_LAST;
+		if (idx >= records.size())
+			records.resize((size_t)idx + 1);
+		records[idx] = rec;
+	}
+
+	void erase(uint32_t id) {
+		const uint32_t idx = id - SIMCONNECTID_LAST;
+		if (id >= SIMCONNECTID_LAST && idx < records.size())
+			records[idx] = T();
+	}
+};
+
+// Key for looking up an already evaluated request result in the per-tick evaluation cache. Requests with equal keys
+// produce the same result when evaluated during the same tick, regardless of which client they belong to.
+struct EvalCacheKey
+{
+	string_view code {};       // calculator code/byte code or variable name; refers to TrackedRequest storage so is only valid during one tick
+	ID variableId = -1;
+	ENUM unitId = -1;
+	uint32_t resultSize = 0;
+	RequestType requestType = RequestType::None;
+	CalcResultType resultType = CalcResultType::None;
+	char varType = 0;
 	uint8_t varIndex = 0;
-	const char *varName = nullptr;
-	size_t resultSize = 0;
-	int8_t resultMemberIndex = -1;
-	FLOAT64 fVal = 0.0;
-	SINT32 iVal = 0;
-	string sVal {};
-	void setF(const FLOAT64 val) { fVal = val; resultSize = sizeof(FLOAT64); resultMemberIndex = 0; }
-	void setI(const SINT32  val) { iVal = val; resultSize = sizeof(SINT32); resultMemberIndex = 1; }
-	void setS(const string &&val) { sVal = std::move(val); sVal.resize(strSize); resultSize = strSize; resultMemberIndex = 2; }
+
+	EvalCacheKey() = default;
+	explicit EvalCacheKey(const TrackedRequest &tr) :
+		code{tr.requestType == RequestType::Calculated && !tr.calcBytecode.empty() ? string_view(tr.calcBytecode) : string_view(tr.nameOrCode)},
+		variableId{tr.variableId}, unitId{tr.unitId}, resultSize{tr.dataSize}, requestType{tr.requestType}, resultType{tr.calcResultType},
+		varType{tr.varTypePrefix}, varIndex{tr.simVarIndex}
+	{	}
+
+	bool operator==(const EvalCacheKey &o) const {
+		return variableId == o.variableId && unitId == o.unitId && resultSize == o.resultSize && requestType == o.requestType
+			&& resultType == o.resultType && varType == o.varType && varIndex == o.varIndex && code == o.code;
+	}
+};
+
+struct EvalCacheKeyHash
+{
+	size_t operator()(const EvalCacheKey &k) const noexcept {
+		size_t h = hash<string_view>{}(k.code);
+		const uint64_t ids = ((uint64_t)(uint32_t)k.variableId << 32) | (uint32_t)k.unitId;
+		const uint64_t meta = ((uint64_t)k.resultSize << 32) | ((uint64_t)k.requestType << 24) | ((uint64_t)k.resultType << 16) | ((uint64_t)(uint8_t)k.varType << 8) | k.varIndex;
+		h ^= hash<uint64_t>{}(ids) + 0x9e3779b9 + (h << 6) + (h >> 2);
+		h ^= hash<uint64_t>{}(meta) + 0x9e3779b9 + (h << 6) + (h >> 2);
+		return h;
+	}
+};
+
+// Per-tick request evaluation results cache, as an open addressing hash table with linear probing. The slots vector is re-used from
+// tick to tick and all entries are invalidated at once by advancing the generation counter, so no allocations are needed once the table
+// has grown to fit the number of distinct requests. Values point to the result buffer of the request which was evaluated.
+struct EvalCache
+{
+	struct Slot {
+		uint64_t generation = 0;
+		EvalCacheKey key {};
+		const calcResult_t *result = nullptr;
+	};
+	vector<Slot> slots = vector<Slot>(64);  // size is always a power of 2
+	uint64_t generation = 1;
+	size_t count = 0;
+
+	const calcResult_t *find(const EvalCacheKey &key) const {
+		const size_t mask = slots.size() - 1;
+		for (size_t i = EvalCacheKeyHash{}(key) & mask; slots[i].generation == generation; i = (i + 1) & mask) {
+			if (slots[i].key == key)
+				return slots[i].result;
+		}
+		return nullptr;
+	}
+
+	void insert(const EvalCacheKey &key, const calcResult_t *result) {
+		// keep the load factor under 1/2 so probe sequences stay short
+		if ((count + 1) * 2 > slots.size())
+			grow();
+		const size_t mask = slots.size() - 1;
+		size_t i = EvalCacheKeyHash{}(key) & mask;
+		while (slots[i].generation == generation)
+			i = (i + 1) & mask;
+		slots[i] = Slot { generation, key, result };
+		++count;
+	}
+
+	void clear() {
+		++generation;
+		count = 0;
+	}
+
+	void grow() {
+		vector<Slot> old(slots.size() * 2);
+		old.swap(slots);
+		const uint64_t gen = generation;
+		clear();
+		for (const Slot &s : old) {
+			if (s.generation == gen)
+				insert(s.key, s.result);
+		}
+	}
 };
 
-typedef map<uint32_t, Client> clientMap_t;
-typedef map<DWORD, DefinitionIdRecord> definitionIdMap_t;
-typedef map<SIMCONNECT_CLIENT_EVENT_ID, EventIdRecord> eventIdMap_t;
-typedef map<uint32_t, SIMCONNECT_CLIENT_EVENT_ID> pingRespEventMap_t;
+typedef unordered_map<uint32_t, Client> clientMap_t;  // node based, so Client pointers held by ID records stay valid
+typedef IdRecordTable<DefinitionIdRecord> definitionIdMap_t;
+typedef IdRecordTable<EventIdRecord> eventIdMap_t;
+typedef unordered_map<uint32_t, SIMCONNECT_CLIENT_EVENT_ID> pingRespEventMap_t;
+typedef priority_queue<ScheduledUpdate, vector<ScheduledUpdate>, greater<ScheduledUpdate>> updateSchedule_t;  // min-heap ordered by due time
+typedef list<pair<string, string>> compiledCodeList_t;  // calculator source code and compiled byte code (empty if compilation failed), most recently used first
+typedef unordered_map<string_view, compiledCodeList_t::iterator> compiledCodeIndex_t;  // keys refer to the source code strings stored in the list
+typedef unordered_map<string, int> nameIdCache_t;  // variable or unit names to IDs
 #pragma endregion Structs
 
 //----------------------------------------------------------------------------
@@ -245,6 +487,46 @@ clientMap_t g_mClients {};
 definitionIdMap_t g_mDefinitionIds {};
 eventIdMap_t g_mEventIds {};
 pingRespEventMap_t g_pingRespEventIds {};
+updateSchedule_t g_updateSchedule {};
+uint64_t g_nextScheduleSeq = 1;
+EvalCache g_evalCache {};                 // request evaluation results of the current tick, shared between all clients
+uint64_t g_evalCacheHits = 0;
+uint64_t g_evalCacheMisses = 0;
+bool g_evalCacheEnabled = true;
+uint64_t g_suppressedWrites = 0;      // total count of value changes which were within a request's deltaEpsilon
+uint32_t g_frameTimeBudget = 0;       // maximum time to spend on data request updates per frame, in microseconds; zero for no limit
+bool g_staggerUpdates = true;         // spread first update times of recurring requests over their update interval
+uint32_t g_nextPhaseSlot = 0;         // rotating counter for staggering update times
+bool g_updateBacklog = false;         // indicates that some due updates were deferred to the next frame because of the time budget
+uint64_t g_deferredFrames = 0;        // number of frames which exceeded the time budget and deferred some updates
+bool g_collectTimingStats = true;     // measure evaluation and command processing times for StatsRecord counters
+compiledCodeList_t g_compiledCode {};  // LRU cache of compiled calculator code, shared by all clients
+compiledCodeIndex_t g_compiledCodeIndex {};
+size_t g_compiledCodeCacheSize = 256;  // maximum number of cached compilation results, zero disables caching
+uint64_t g_compiledCodeHits = 0;
+uint64_t g_compiledCodeMisses = 0;
+uint32_t g_execCompileRepeats = 3;    // number of times the same Exec command code must be run before it is compiled and cached, zero to never compile Exec code
+unordered_map<size_t, uint32_t> g_execCodeRepeats {};  // hashes of recently run Exec command code which isn't cached yet, and how often each one was run
+uint32_t g_listItemsPerTick = 1000;   // maximum number of L vars to list per tick, zero for no limit
+uint32_t g_logQueueSize = 250;        // maximum number of log records queued per client between batches, zero to send each record as it is logged
+bool g_clientLogsPending = false;     // set when any client has queued log records
+uint32_t g_clientUpdatesPerTick = 0;  // maximum number of request updates to process per client per tick, zero for no limit
+uint32_t g_clientBytesPerTick = 0;    // maximum number of value data bytes to write per client per tick, zero for no limit
+vector<Client *> g_dueClients[REQUEST_PRIORITY_CLASSES] {};  // clients with updates due on the current tick for each priority class in client ID order, serviced round-robin
+uint32_t g_roundRobinClientId = 0;    // ID of the first client serviced on the previous tick, the next one in ID order goes first on the following tick
+uint64_t g_throttledClientTicks = 0;  // number of times a client's updates were deferred due to the per-client limits
+uint32_t g_normalPriorityBudget = 90;   // percentage of the frame time budget which Normal priority updates may use; the rest is reserved for Background priority
+struct { uint64_t count, total; uint32_t max; } g_priorityLag[REQUEST_PRIORITY_CLASSES] {};  // scheduled update delay totals for each priority class, in microseconds
+vector<SetterStreamRecord> g_pendingSetters {};  // streamed L var values to apply on the next frame, one per variable
+bool g_settersResumedTrigger = false;  // the frame event was resumed to apply streamed values and may not be needed once they stop arriving
+uint64_t g_streamedSetters = 0;       // total number of streamed L var values received
+uint64_t g_appliedSetters = 0;        // total number of streamed L var values applied, the rest were superseded by newer values in the same frame
+uint64_t g_coalescedKeyEvents = 0;    // total number of key event triggers saved by coalescing
+struct { const Client *client; uint32_t token; vector<uint8_t> block; } g_commandBatch {};  // command batch being processed; responses to its client are collected in the results block, see processCommandBatch()
+bool g_nameIdCacheEnabled = true;     // cache results of variable and unit name lookups
+nameIdCache_t g_localVarIdCache {};   // only valid IDs are cached for L vars since new ones may be created at any time
+nameIdCache_t g_simVarIdCache {};
+nameIdCache_t g_unitIdCache {};
 steady_clock::time_point g_tpNextTick { steady_clock::now() };
 SIMCONNECT_CLIENT_EVENT_ID g_nextClientEventId = SIMCONNECTID_LAST;
 SIMCONNECT_CLIENT_DATA_DEFINITION_ID g_nextClienDataId = SIMCONNECTID_LAST;
@@ -255,10 +537,43 @@ bool g_triggersRegistered = false;
 #pragma region Client Responses
 //----------------------------------------------------------------------------
 
+// Writes the pending command batch results block to the batch client's results data area.
+void flushBatchResults()
+{
+	vector<uint8_t> &block = g_commandBatch.block;
+	if (block.size() <= sizeof(CommandBatchHeader))
+		return;
+	CommandBatchHeader *hdr = reinterpret_cast<CommandBatchHeader *>(block.data());
+	hdr->dataSize = uint16_t(block.size() - sizeof(CommandBatchHeader));
+	block.resize(COMMAND_BATCH_AREA_SIZE);
+	const Client *c = g_commandBatch.client;
+	INVOKE_SIMCONNECT(SetClientData, g_hSimConnect, c->cddID_batchResults, c->cddID_batchResults, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL, (DWORD)COMMAND_BATCH_AREA_SIZE, (void *)block.data());
+	block.clear();
+}
+
+// Adds a response to the pending command batch results block, flushing the block first if it is full.
+void addBatchResult(const Command &cmd)
+{
+	vector<uint8_t> &block = g_commandBatch.block;
+	if (!block.empty() && !appendCommandBatchRecord(block, cmd))
+		flushBatchResults();
+	if (block.empty()) {
+		block.resize(sizeof(CommandBatchHeader));
+		*reinterpret_cast<CommandBatchHeader *>(block.data()) = CommandBatchHeader { g_commandBatch.token, 0, 0 };
+		appendCommandBatchRecord(block, cmd);  // always fits in an empty block
+	}
+	++reinterpret_cast<CommandBatchHeader *>(block.data())->recordCount;
+}
+
 bool sendResponse(const Client *c, const Command &cmd)
 {
 	if (c->status != ClientStatus::Connected)
 		return false;
+	if (c == g_commandBatch.client) {
+		LOG_TRC << "Adding batch result for " << c->name << ": " << cmd;
+		addBatchResult(cmd);
+		return true;
+	}
 	LOG_TRC << "Sending command to " << c->name << ": " << cmd;
 	return INVOKE_SIMCONNECT(
 		SetClientData, g_hSimConnect,
@@ -268,11 +583,38 @@ bool sendResponse(const Client *c, const Command &cmd)
 	);
 }
 
+// Returns true if the client enabled the SuppressAcks option. Responses to commands in a batch are never suppressed, so that the batch results always hold an Ack or Nak for each command.
+bool acksSuppressed(const Client *c) {
+	return c->suppressAcks && c != g_commandBatch.client;
+}
+
+// Returns true if an Ack for a successful command of the given type should not be sent because the client enabled the SuppressAcks option.
+// Only commands whose Ack carries no result data are affected. Exec is handled in execCalculatorCode() since it depends on the result type.
+bool isAckSuppressed(const Client *c, CommandId commandId)
+{
+	if (!acksSuppressed(c))
+		return false;
+	switch (commandId) {
+		case CommandId::Set:
+		case CommandId::SetCreate:
+		case CommandId::Transmit:
+		case CommandId::SendKey:
+		case CommandId::Update:
+			return true;
+		default:
+			return false;
+	}
+}
+
 bool sendAckNak(const Client *c, const Command &forCmd, bool ack = true, const char *msg = nullptr, double fData = 0.0) {
+	if (ack && isAckSuppressed(c, forCmd.commandId))
+		return true;
 	return sendResponse(c, Command(ack ? CommandId::Ack : CommandId::Nak, +forCmd.commandId, msg, fData, forCmd.token));
 }
 
 bool sendAckNak(const Client *c, CommandId commandId, bool ack = true, uint32_t token = 0, const char *msg = nullptr, double fData = 0.0) {
+	if (ack && isAckSuppressed(c, commandId))
+		return true;
 	return sendResponse(c, Command(ack ? CommandId::Ack : CommandId::Nak, +commandId, msg, fData, token));
 }
 
@@ -303,16 +645,146 @@ bool sendLogRecord(const Client *c, const LogRecord &log)
 	);
 }
 
-bool writeRequestData(const Client *c, const TrackedRequest *tr, void *data)
+// Writes the client's pending packed log records batch to the log data area and resets the batch.
+bool flushLogDataBlock(Client *c)
+{
+	vector<uint8_t> &block = c->logQueue.block;
+	if (block.size() <= sizeof(LogDataHeader))
+		return true;
+	LogDataHeader *hdr = reinterpret_cast<LogDataHeader *>(block.data());
+	hdr->sequence = ++c->logQueue.sequence;
+	hdr->dataSize = (uint16_t)(block.size() - sizeof(LogDataHeader));
+	// the data area is always written in full; capacity is reserved when the option is enabled
+	block.resize(LOG_DATA_AREA_SIZE);
+	const bool ret = SUCCEEDED(INVOKE_SIMCONNECT(
+		SetClientData, g_hSimConnect,
+		c->cddID_logData, c->cddID_logData,
+		SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL,
+		(DWORD)LOG_DATA_AREA_SIZE, (void *)block.data()
+	));
+	block.clear();
+	return ret;
+}
+
+// Sends one log record to the client, either by adding it to the current packed batch or as a full LogRecord struct.
+void sendClientLogRecord(Client *c, time_t timestamp, LogLevel level, const char *message, size_t len)
+{
+	len = std::min(len, STRSZ_LOG - 1);
+	if (!c->logQueue.packed) {
+		LogRecord log(level);
+		log.timestamp = timestamp;
+		memcpy(log.message, message, len);
+		sendLogRecord(c, log);
+		return;
+	}
+	vector<uint8_t> &block = c->logQueue.block;
+	const size_t recordSize = sizeof(LogDataRecord) + len + 1;
+	if (block.size() + recordSize > LOG_DATA_AREA_SIZE)
+		flushLogDataBlock(c);
+	if (block.empty())
+		block.resize(sizeof(LogDataHeader));  // zero-initialized header
+	const LogDataRecord rec { timestamp, level, 0, (uint16_t)(len + 1) };
+	block.insert(block.end(), reinterpret_cast<const uint8_t *>(&rec), reinterpret_cast<const uint8_t *>(&rec) + sizeof(LogDataRecord));
+	block.insert(block.end(), message, message + len);
+	block.push_back(0);
+	++reinterpret_cast<LogDataHeader *>(block.data())->recordCount;
+}
+
+// Sends all of the client's queued log records, preceded by a notice if any had to be dropped since the last time.
+void flushClientLog(Client *c)
+{
+	LogQueue &q = c->logQueue;
+	if (!q.count && !q.dropped)
+		return;
+	if (c->status != ClientStatus::Connected || !c->cddID_log) {
+		q.head = q.count = q.dropped = 0;
+		return;
+	}
+	q.sending = true;
+	if (q.dropped) {
+		const string msg = to_string(q.dropped) + " log messages dropped";
+		sendClientLogRecord(c, q.count ? q.ring[q.head].timestamp : duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count(), LogLevel::Warning, msg.c_str(), msg.size());
+		q.dropped = 0;
+	}
+	for (; q.count; --q.count) {
+		const LogQueue::Entry &e = q.ring[q.head];
+		sendClientLogRecord(c, e.timestamp, e.level, e.message.c_str(), e.message.size());
+		q.head = (q.head + 1) % q.ring.size();
+	}
+	q.head = 0;
+	if (q.packed)
+		flushLogDataBlock(c);
+	q.sending = false;
+}
+
+// Sends queued log records of all clients.
+void flushClientLogs()
+{
+	g_clientLogsPending = false;
+	for (clientMap_t::value_type &cp : g_mClients)
+		flushClientLog(&cp.second);
+}
+
+// Sends any pending packed data value updates to the client and resets the packed data block.
+bool flushPackedData(Client *c)
+{
+	if (c->packedData.empty())
+		return true;
+	PackedDataHeader *hdr = reinterpret_cast<PackedDataHeader *>(c->packedData.data());
+	hdr->sequence = ++c->packedDataSeq;
+	hdr->dataSize = (uint16_t)(c->packedData.size() - sizeof(PackedDataHeader));
+	// the data area is always written in full; this does not re-allocate since capacity is reserved when packed updates are enabled
+	c->packedData.resize(PACKED_DATA_AREA_SIZE);
+	bool ret = false;
+	if (c->status == ClientStatus::Connected) {
+		LOG_TRC << "Writing packed data block " << hdr->sequence << " with " << hdr->recordCount << " records of total size " << hdr->dataSize << " for " << c->name;
+		ret = SUCCEEDED(INVOKE_SIMCONNECT(
+			SetClientData, g_hSimConnect,
+			c->cddID_packedData, c->cddID_packedData,
+			SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL,
+			(DWORD)PACKED_DATA_AREA_SIZE, (void *)c->packedData.data()
+		));
+	}
+	c->packedData.clear();
+	return ret;
+}
+
+// Adds a request value to the client's pending packed data block, sending the current block first if the new record would not fit.
+// Returns false if the value is too large to fit into a packed data block at all.
+bool appendPackedData(Client *c, const TrackedRequest *tr, const void *data)
+{
+	const size_t recordSize = sizeof(PackedDataRecord) + tr->dataSize;
+	if (recordSize > PACKED_DATA_AREA_SIZE - sizeof(PackedDataHeader))
+		return false;
+	if (c->packedData.size() + recordSize > PACKED_DATA_AREA_SIZE)
+		flushPackedData(c);
+	if (c->packedData.empty())
+		c->packedData.resize(sizeof(PackedDataHeader));  // zero-initialized header
+	const PackedDataRecord rec { tr->requestId, tr->dataSize };
+	c->packedData.insert(c->packedData.end(), reinterpret_cast<const uint8_t *>(&rec), reinterpret_cast<const uint8_t *>(&rec) + sizeof(PackedDataRecord));
+	c->packedData.insert(c->packedData.end(), static_cast<const uint8_t *>(data), static_cast<const uint8_t *>(data) + tr->dataSize);
+	++reinterpret_cast<PackedDataHeader *>(c->packedData.data())->recordCount;
+	return true;
+}
+
+bool writeRequestData(Client *c, TrackedRequest *tr, const void *data)
 {
 	if (c->status != ClientStatus::Connected)
 		return false;
+	++tr->stats.writeCount;
+	++c->stats.writeCount;
+	c->tickBytes += tr->dataSize;
+	// Packed updates are sent at the end of the current tick or message dispatch; values which do not fit into a packed block are written to the request's own data area.
+	if (c->packedDataUpdates && appendPackedData(c, tr, data)) {
+		LOG_TRC << "Queued request ID " << tr->requestId << " packed data for " << c->name << " of size " << tr->dataSize;
+		return true;
+	}
 	LOG_TRC << "Writing request ID " << tr->requestId << " data for " << c->name << " to CDA / CDD ID " << tr->dataId << " of size " << tr->dataSize;
 	return INVOKE_SIMCONNECT(
 		SetClientData, g_hSimConnect,
 		tr->dataId, tr->dataId,
 		SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL,
-		(DWORD)tr->dataSize, data
+		(DWORD)tr->dataSize, const_cast<void *>(data)
 	);
 }
 #pragma endregion Client Responses
@@ -331,18 +803,12 @@ Client *findClient(uint32_t id)
 
 const DefinitionIdRecord *findDefinitionRecord(uint32_t definitionId)
 {
-	const definitionIdMap_t::const_iterator pos = g_mDefinitionIds.find(definitionId);
-	if (pos != g_mDefinitionIds.cend())
-		return &pos->second;
-	return nullptr;
+	return g_mDefinitionIds.find(definitionId);
 }
 
 const EventIdRecord *findEventRecord(uint32_t id)
 {
-	const eventIdMap_t::const_iterator pos = g_mEventIds.find(id);
-	if (pos != g_mEventIds.cend())
-		return &pos->second;
-	return nullptr;
+	return g_mEventIds.find(id);
 }
 
 TrackedRequest *findClientRequest(Client *c, uint32_t id)
@@ -411,6 +877,42 @@ bool registerClientKeyEventDataArea(const Client *c)
 	return SUCCEEDED(INVOKE_SIMCONNECT(RequestClientData, g_hSimConnect, c->cddID_keyEvent, c->cddID_keyEvent, c->cddID_keyEvent, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL));
 }
 
+bool registerClientKeyEventQueueDataArea(const Client *c)
+{
+	// Key event queue area is named "WASimCommander.KeyEventQueue.<client_name>"; client can write to this.
+	const string cdaName(CDA_NAME_KEYQUEUE_PFX + c->name);
+	if FAILED(SimConnectHelper::registerDataArea(g_hSimConnect, cdaName, c->cddID_keyEventQueue, c->cddID_keyEventQueue, KEY_EVENT_QUEUE_AREA_SIZE, false))
+		return false;
+	LOG_DBG << "Created CDA ID " << c->cddID_keyEventQueue << " named " << quoted(cdaName) << " of size " << KEY_EVENT_QUEUE_AREA_SIZE;
+
+	// Listen for queued key events
+	return SUCCEEDED(INVOKE_SIMCONNECT(RequestClientData, g_hSimConnect, c->cddID_keyEventQueue, c->cddID_keyEventQueue, c->cddID_keyEventQueue, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL));
+}
+
+bool registerClientCommandBatchDataArea(const Client *c)
+{
+	// Command batch area is named "WASimCommander.CommandBatch.<client_name>"; client can write to this.
+	const string cdaName(CDA_NAME_CMDBATCH_PFX + c->name);
+	if FAILED(SimConnectHelper::registerDataArea(g_hSimConnect, cdaName, c->cddID_commandBatch, c->cddID_commandBatch, COMMAND_BATCH_AREA_SIZE, false))
+		return false;
+	LOG_DBG << "Created CDA ID " << c->cddID_commandBatch << " named " << quoted(cdaName) << " of size " << COMMAND_BATCH_AREA_SIZE;
+
+	// Listen for command batches
+	return SUCCEEDED(INVOKE_SIMCONNECT(RequestClientData, g_hSimConnect, c->cddID_commandBatch, c->cddID_commandBatch, c->cddID_commandBatch, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL));
+}
+
+bool registerClientSetterStreamDataArea(const Client *c)
+{
+	// Setter stream area is named "WASimCommander.SetterStream.<client_name>"; client can write to this.
+	const string cdaName(CDA_NAME_SETTER_PFX + c->name);
+	if FAILED(SimConnectHelper::registerDataArea(g_hSimConnect, cdaName, c->cddID_setterStream, c->cddID_setterStream, SETTER_STREAM_AREA_SIZE, false))
+		return false;
+	LOG_DBG << "Created CDA ID " << c->cddID_setterStream << " named " << quoted(cdaName) << " of size " << SETTER_STREAM_AREA_SIZE;
+
+	// Listen for streamed values
+	return SUCCEEDED(INVOKE_SIMCONNECT(RequestClientData, g_hSimConnect, c->cddID_setterStream, c->cddID_setterStream, c->cddID_setterStream, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET, 0UL, 0UL, 0UL, 0UL));
+}
+
 bool registerClientLogDataArea(const Client *c)
 {
 	// Log area is  named "WASimCommander.Log.<client_name>"; read-only for client
@@ -421,6 +923,35 @@ bool registerClientLogDataArea(const Client *c)
 	return true;
 }
 
+// Returns the first ID found for a name in a client's name index, or -1 if not found.
+int findNameIndex(const nameIndex_t &index, const char *name)
+{
+	const nameIndex_t::const_iterator pos = index.find(name);
+	return pos != index.cend() ? (int)pos->second : -1;
+}
+
+// Removes the entry for a specific name and ID from a client's name index.
+void removeNameIndex(nameIndex_t &index, const string &name, uint32_t id)
+{
+	const auto range = index.equal_range(name);
+	for (nameIndex_t::const_iterator it = range.first; it != range.second; ++it) {
+		if (it->second == id) {
+			index.erase(it);
+			return;
+		}
+	}
+}
+
+bool registerClientPackedDataArea(const Client *c)
+{
+	// Packed data area is named "WASimCommander.PackedData.<client_name>"; read-only for client
+	const string cdaName(CDA_NAME_PACKED_PFX + c->name);
+	if FAILED(SimConnectHelper::registerDataArea(g_hSimConnect, cdaName, c->cddID_packedData, c->cddID_packedData, PACKED_DATA_AREA_SIZE, false))
+		return false;
+	LOG_DBG << "Created CDA ID " << c->cddID_packedData << " named " << quoted(cdaName) << " of size " << PACKED_DATA_AREA_SIZE;
+	return true;
+}
+
 bool registerClientVariableDataArea(const Client *c, uint32_t areaId, uint32_t dataId, DWORD dataAreaSize, DWORD sizeOrType)
 {
 	// Individual variable value data areas are named "WASimCommander.Data.<client_name>.<areaId>"; read-only for client
@@ -438,19 +969,14 @@ void removeClientVariableDataArea(const TrackedRequest *tr)
 		LOG_WRN << "Failed to clear ClientDataDefinition for requestId " << tr->requestId << ", check log messages.";
 }
 
-void removeClientCustomEvent(const Client *c, uint32_t eventId)
+void removeClientCustomEvent(const Client *c, const TrackedEvent &ev)
 {
-	SIMCONNECT_CLIENT_EVENT_ID clientEventId = 0;
-	for (auto it = g_mEventIds.cbegin(), en = g_mEventIds.cend(); !clientEventId && it != en; ++it) {
-		if (it->second.client == c && it->second.eventId == eventId)
-			clientEventId = it->first;
-	}
-	if (!clientEventId) {
-		LOG_WRN << "Could not find SIMCONNECT_CLIENT_EVENT_ID record for client " << c->name << " with event ID " << eventId;
+	if (!ev.clientEventId) {
+		LOG_WRN << "Could not find SIMCONNECT_CLIENT_EVENT_ID record for client " << c->name << " with event ID " << ev.eventId;
 		return;
 	}
-	INVOKE_SIMCONNECT(RemoveClientEvent, g_hSimConnect, (DWORD)c->clientId, clientEventId);
-	g_mEventIds.erase(clientEventId);
+	INVOKE_SIMCONNECT(RemoveClientEvent, g_hSimConnect, (DWORD)c->clientId, ev.clientEventId);
+	g_mEventIds.erase(ev.clientEventId);
 	//LOG_INF << "Deleted registered event ID " << eventId << " for Client " << c->name;
 }
 
@@ -473,19 +999,28 @@ Client *getOrCreateClient(uint32_t clientId)
 	c.cddID_response = g_nextClienDataId++;
 	c.cddID_request = g_nextClienDataId++;
 	c.cddID_keyEvent = g_nextClienDataId++;
+	c.cddID_commandBatch = g_nextClienDataId++;
+	c.cddID_setterStream = g_nextClienDataId++;
+	c.cddID_keyEventQueue = g_nextClienDataId++;
 
 	// register all data areas for this client with SimConnect
 	if (!registerClientCommandDataAreas(&c))
 		return nullptr;  // dispose client on failure
 	registerClientRequestDataArea(&c);
 	registerClientKeyEventDataArea(&c);
+	registerClientCommandBatchDataArea(&c);
+	registerClientSetterStreamDataArea(&c);
+	registerClientKeyEventQueueDataArea(&c);
 
 	// move client record into map
 	Client *pC = &g_mClients.emplace(clientId, std::move(c)).first->second;
 	// save mappings of the command and request data IDs (which SimConnect sends us) to the client record; for lookup in message dispatch.
-	g_mDefinitionIds.emplace(piecewise_construct, forward_as_tuple(c.cddID_command), forward_as_tuple(RecordType::CommandData, pC));  // no try_emplace?
-	g_mDefinitionIds.emplace(piecewise_construct, forward_as_tuple(c.cddID_request), forward_as_tuple(RecordType::RequestData, pC));
-	g_mDefinitionIds.emplace(piecewise_construct, forward_as_tuple(c.cddID_keyEvent), forward_as_tuple(RecordType::KeyEventData, pC));
+	g_mDefinitionIds.set(pC->cddID_command, DefinitionIdRecord(RecordType::CommandData, pC));
+	g_mDefinitionIds.set(pC->cddID_request, DefinitionIdRecord(RecordType::RequestData, pC));
+	g_mDefinitionIds.set(pC->cddID_keyEvent, DefinitionIdRecord(RecordType::KeyEventData, pC));
+	g_mDefinitionIds.set(pC->cddID_commandBatch, DefinitionIdRecord(RecordType::CommandBatchData, pC));
+	g_mDefinitionIds.set(pC->cddID_setterStream, DefinitionIdRecord(RecordType::SetterStreamData, pC));
+	g_mDefinitionIds.set(pC->cddID_keyEventQueue, DefinitionIdRecord(RecordType::KeyEventQueueData, pC));
 
 	LOG_INF << "Created new Client with name " << pC->name << " from ID " << clientId;
 	return pC;
@@ -531,8 +1066,25 @@ void disconnectClient(Client *c, ClientStatus newStatus = ClientStatus::Disconne
 	c->requests.clear();
 	// clear all registered events
 	for (const auto &ev : c->events)
-		removeClientCustomEvent(c, ev.first);
+		removeClientCustomEvent(c, ev.second);
 	c->events.clear();
+	c->requestNameIndex.clear();
+	c->eventCodeIndex.clear();
+	// options need to be set again by the client after re-connecting
+	c->packedDataUpdates = false;
+	c->packedData.clear();
+	c->updateHeartbeat = steady_clock::duration::zero();
+	c->deltaHysteresis = 0.0f;
+	c->suppressAcks = false;
+	c->keyEventReadSeq = 0;
+	c->keyEventQueue = false;
+	c->coalescedKeyEventIds.clear();
+	c->coalescedKeyEvents.clear();
+	c->stats = StatsRecord { c->clientId };
+	c->listCursor = ListCursor();
+	c->logQueue.head = c->logQueue.count = c->logQueue.dropped = 0;
+	c->logQueue.packed = false;
+	c->logQueue.block.clear();
 
 	LOG_INF << "Disconnected Client " << c->name;
 	checkTriggerEventNeeded();  // check if anyone is still connected
@@ -560,9 +1112,28 @@ void disableAllClients()
 // callback for logfault IdProxyHandler log handler
 void CALLBACK clientLogHandler(const uint32_t id, const logfault::Message &msg)
 {
-	const Client *c = findClient(id);
-	if (c && c->status == ClientStatus::Connected)
+	Client *c = findClient(id);
+	if (!c || c->status != ClientStatus::Connected || c->logQueue.sending)
+		return;
+	if (!g_logQueueSize) {
 		sendLogRecord(c, LogRecord((LogLevel)msg.level_, msg.msg_.c_str(), msg.when_));
+		return;
+	}
+	// queue the record to be sent with the next batch, overwriting the oldest one if the queue is full
+	LogQueue &q = c->logQueue;
+	if (q.ring.size() != g_logQueueSize)
+		q.ring.resize(g_logQueueSize);
+	if (q.count == q.ring.size()) {
+		q.head = (q.head + 1) % q.ring.size();
+		--q.count;
+		++q.dropped;
+	}
+	LogQueue::Entry &e = q.ring[(q.head + q.count) % q.ring.size()];
+	e.timestamp = duration_cast<milliseconds>(msg.when_.time_since_epoch()).count();
+	e.level = (LogLevel)msg.level_;
+	e.message.assign(msg.msg_, 0, STRSZ_LOG - 1);
+	++q.count;
+	g_clientLogsPending = true;
 }
 
 bool setClientLogLevel(Client *c, LogLevel level)
@@ -607,7 +1178,25 @@ void pauseTriggerEvent()
 	if FAILED(INVOKE_SIMCONNECT(SetSystemEventState, g_hSimConnect, (SIMCONNECT_CLIENT_EVENT_ID)EVENT_FRAME, SIMCONNECT_STATE_OFF))
 		return;
 	g_triggersRegistered = false;
+	g_settersResumedTrigger = false;
 	LOG_INF << "DataRequest update processing stopped.";
+	if (g_evalCacheEnabled)
+		LOG_DBG << "Request evaluation cache hits: " << g_evalCacheHits << "; misses: " << g_evalCacheMisses;
+	LOG_DBG << "Value updates suppressed by deltaEpsilon: " << g_suppressedWrites;
+	if (g_frameTimeBudget)
+		LOG_DBG << "Frames with deferred updates due to time budget: " << g_deferredFrames;
+	if (g_clientUpdatesPerTick || g_clientBytesPerTick)
+		LOG_DBG << "Client updates deferred due to per-client limits: " << g_throttledClientTicks;
+	for (size_t i = 0; i < REQUEST_PRIORITY_CLASSES; ++i) {
+		if (g_priorityLag[i].count)
+			LOG_DBG << RequestPriorityNames[i] << " priority updates: " << g_priorityLag[i].count << "; average lag: " << g_priorityLag[i].total / g_priorityLag[i].count << "us; max lag: " << g_priorityLag[i].max << "us";
+	}
+	if (g_streamedSetters)
+		LOG_DBG << "Streamed L var values received: " << g_streamedSetters << "; applied: " << g_appliedSetters;
+	if (g_coalescedKeyEvents)
+		LOG_DBG << "Key event triggers saved by coalescing: " << g_coalescedKeyEvents;
+	if (g_compiledCodeCacheSize)
+		LOG_DBG << "Compiled calculator code cache hits: " << g_compiledCodeHits << "; misses: " << g_compiledCodeMisses << "; entries: " << g_compiledCode.size();
 }
 
 // check if any clients are connected and stop the tick() trigger if none are;
@@ -615,14 +1204,83 @@ void pauseTriggerEvent()
 //  they still have any active data subscriptions... but that seems excessive.
 void checkTriggerEventNeeded()
 {
+	if (!g_pendingSetters.empty())
+		return;
 	for (const clientMap_t::value_type &it : g_mClients) {
 		const Client &c = it.second;
-		if (c.status == ClientStatus::Connected && !c.pauseDataUpdates && c.requests.size())
+		if (c.status == ClientStatus::Connected && ((!c.pauseDataUpdates && c.requests.size()) || c.listCursor.active || !c.coalescedKeyEvents.empty()))
 			return;
 	}
 	pauseTriggerEvent();
 }
 
+// Returns the byte code of previously compiled calculator code from the module-wide LRU cache, or nullptr if the code isn't cached.
+// The returned byte code is empty if the code failed to compile. The pointer is valid until the next change to the cache.
+const string *findCompiledCalculatorCode(const string_view code)
+{
+	if (!g_compiledCodeCacheSize)
+		return nullptr;
+	const compiledCodeIndex_t::iterator pos = g_compiledCodeIndex.find(code);
+	if (pos == g_compiledCodeIndex.end())
+		return nullptr;
+	++g_compiledCodeHits;
+	// move to front as the most recently used entry
+	g_compiledCode.splice(g_compiledCode.begin(), g_compiledCode, pos->second);
+	return &pos->second->second;
+}
+
+// Compiles calculator code to byte code with gauge_calculator_code_precompile(), using previous results from the module-wide LRU cache if possible.
+// Returns false if compilation failed, in which case the `bytecode` is empty.
+bool compileCalculatorCode(const string_view code, string &bytecode)
+{
+	if (const string *cached = findCompiledCalculatorCode(code)) {
+		bytecode = *cached;
+		return !bytecode.empty();
+	}
+	if (g_compiledCodeCacheSize)
+		++g_compiledCodeMisses;
+
+	string source(code);
+	PCSTRINGZ pCompiled = nullptr;
+	UINT32 uCompiledSize = 0;
+	const bool ok = gauge_calculator_code_precompile(&pCompiled, &uCompiledSize, source.c_str());
+	if (ok && pCompiled && uCompiledSize > 0) {
+		bytecode.assign(pCompiled, uCompiledSize);
+		// DO NOT try to log the compiled code as a string -- it's byte code now and may crash the logger
+		LOG_DBG << "Got compiled calculator string with size " << uCompiledSize << ": " << Utilities::byteArrayToHex(pCompiled, uCompiledSize);
+	}
+	else {
+		bytecode.clear();
+		LOG_DBG << "gauge_calculator_code_precompile() returned: " << boolalpha << ok << "; size: " << uCompiledSize << "; Result null? " << (pCompiled == nullptr) << "; Original code : " << quoted(source);
+	}
+
+	// failed results are cached as well, to avoid trying to compile the same code again
+	if (g_compiledCodeCacheSize) {
+		if (g_compiledCode.size() >= g_compiledCodeCacheSize) {
+			g_compiledCodeIndex.erase(g_compiledCode.back().first);
+			g_compiledCode.pop_back();
+		}
+		g_compiledCode.emplace_front(move(source), bytecode);
+		g_compiledCodeIndex.emplace(g_compiledCode.front().first, g_compiledCode.begin());
+	}
+	return !bytecode.empty();
+}
+
+// Returns true when the same (uncached) Exec command code has been run `g_execCompileRepeats` times, meaning it is worth compiling.
+// Only hashes of the code are tracked, which are forgotten once there are a lot more of them than the compiled code cache holds.
+bool isRepeatedExecCode(const string_view code)
+{
+	if (!g_execCompileRepeats || !g_compiledCodeCacheSize)
+		return false;
+	if (g_execCodeRepeats.size() >= g_compiledCodeCacheSize * 4)
+		g_execCodeRepeats.clear();
+	const size_t key = hash<string_view>{}(code);
+	if (++g_execCodeRepeats[key] < g_execCompileRepeats)
+		return false;
+	g_execCodeRepeats.erase(key);
+	return true;
+}
+
 bool execCalculatorCode(const char *code, calcResult_t &result, bool precompiled = false)
 {
 	// DO NOT try to log a compiled code "string" -- it's byte code and may crash the logger
@@ -636,16 +1294,16 @@ bool execCalculatorCode(const char *code, calcResult_t &result, bool precompiled
 		return ok;
 	}
 	if (result.type == CalcResultType::Formatted) {
-		result.setS(string(result.strSize, '\0'));
+		result.setS("", 0);
 		ok = format_calculator_string(&result.sVal[0], result.strSize, code);
 		LOG_TRC << "format_calculator_string() returned: ok: " << boolalpha << ok << "; sVal: " << quoted(result.sVal);
 		return ok;
 	}
 	PCSTRINGZ cVal = nullptr;
 	if ((ok = execute_calculator_code(code, &result.fVal, &result.iVal, &cVal))) {
-		// exec_calc always produces a string, so store that in the result regardless of the requested type (unlikely to be null but check JIC)
-		if (!!cVal)
-			result.setS(string(cVal, strnlen(cVal, result.strSize)));
+		// exec_calc always produces a string, so store that in the result regardless of the requested type, unless the caller has no use for it (unlikely to be null but check JIC)
+		if (!!cVal && (result.keepString || result.type == CalcResultType::String))
+			result.setS(cVal, strnlen(cVal, result.strSize));
 		switch (result.type) {
 			case CalcResultType::Double:
 				result.resultMemberIndex = 0;
@@ -658,7 +1316,7 @@ bool execCalculatorCode(const char *code, calcResult_t &result, bool precompiled
 			case CalcResultType::String:
 				// in case the string result was null (unlikely), set an empty string
 				if (!cVal)
-					result.setS(string());
+					result.setS("", 0);
 				break;
 			default:
 				break;
@@ -744,7 +1402,7 @@ bool getNamedVariableValue(char varType, calcResult_t &result)
 
 				case TYPE_PVOID: {
 					const char *cVal = reinterpret_cast<const char *>(gs_var.var_value.p);
-					result.setS(string(cVal, strnlen(cVal, result.strSize)));
+					result.setS(cVal, strnlen(cVal, result.strSize));
 					break;
 				}
 
@@ -768,7 +1426,28 @@ bool getNamedVariableValue(char varType, calcResult_t &result)
 	return true;
 }
 
-int getVariableId(char varType, const char *name, bool createLocal = false)
+// Returns the name lookup cache for a variable type, or null if that type is not cached.
+// Token vars are resolved with the compile-time hash table of their names (see Utilities::getTokenVariableId()), which is as fast as a cache lookup.
+nameIdCache_t *variableIdCache(char varType)
+{
+	if (!g_nameIdCacheEnabled)
+		return nullptr;
+	switch (varType) {
+		case 'L': return &g_localVarIdCache;
+		case 'A': return &g_simVarIdCache;
+		default:  return nullptr;
+	}
+}
+
+void clearNameIdCaches()
+{
+	LOG_DBG << "Clearing name lookup caches with " << g_localVarIdCache.size() << " L, " << g_simVarIdCache.size() << " A var and " << g_unitIdCache.size() << " unit entries.";
+	g_localVarIdCache.clear();
+	g_simVarIdCache.clear();
+	g_unitIdCache.clear();
+}
+
+int lookupVariableId(char varType, const char *name, bool createLocal)
 {
 	switch (varType)
 	{
@@ -795,6 +1474,35 @@ int getVariableId(char varType, const char *name, bool createLocal = false)
 	}
 }
 
+// Returns the ID of a named variable, using cached results from previous lookups if possible. Optionally creates a local variable if it doesn't exist.
+int getVariableId(char varType, const char *name, bool createLocal = false)
+{
+	nameIdCache_t *cache = variableIdCache(varType);
+	if (!cache)
+		return lookupVariableId(varType, name, createLocal);
+	const nameIdCache_t::const_iterator pos = cache->find(name);
+	if (pos != cache->cend())
+		return pos->second;
+	const int id = lookupVariableId(varType, name, createLocal);
+	// an L var which doesn't exist now may be created later
+	if (id > -1 || varType != 'L')
+		cache->emplace(name, id);
+	return id;
+}
+
+// Returns the ID of a named unit type, using cached results from previous lookups if possible.
+ENUM getUnitId(const char *name)
+{
+	if (!g_nameIdCacheEnabled)
+		return get_units_enum(name);
+	const nameIdCache_t::const_iterator pos = g_unitIdCache.find(name);
+	if (pos != g_unitIdCache.cend())
+		return pos->second;
+	const ENUM id = get_units_enum(name);
+	g_unitIdCache.emplace(name, id);
+	return id;
+}
+
 // Parse a command string to find a variable name/unit/index and populates the respective reference params.
 // Lookups are done on var names, depending on varType, and unit strings, to attempt conversion to IDs.
 // Used by setVariable() and getVariable(). Only handles A/L/T var types (not needed for others).
@@ -831,10 +1539,10 @@ bool parseVariableString(const char varType, const char *data, ID &varId, bool c
 	if (result.ec != errc()) {
 		const std::string vname(svVar);
 		if (createLocal && !!existed) {
-			varId = check_named_variable(vname.c_str());
+			varId = getVariableId(varType, vname.c_str());
 			*existed = varId > -1;
 			if (!*existed)
-				varId = register_named_variable(vname.c_str());
+				varId = getVariableId(varType, vname.c_str(), true);
 		}
 		else {
 			varId = getVariableId(varType, vname.c_str(), createLocal);
@@ -851,7 +1559,7 @@ bool parseVariableString(const char varType, const char *data, ID &varId, bool c
 		result = from_chars(svUnit.data(), svUnit.data() + svUnit.size(), *unitId);
 		// if number conversion failed, look up unit id
 		if (result.ec != errc()) {
-			*unitId = get_units_enum(string(svUnit).c_str());  // this may also fail but unit ID is not "critical" (caller can decide what to do)
+			*unitId = getUnitId(string(svUnit).c_str());  // this may also fail but unit ID is not "critical" (caller can decide what to do)
 			if (*unitId < 0)
 				LOG_WRN << "Could not resolve Unit ID from string " << quoted(data);
 		}
@@ -884,6 +1592,76 @@ void returnPingEvent(DWORD data)
 		                SIMCONNECT_GROUP_PRIORITY_HIGHEST, SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY);
 }
 
+// forward, in Data Requests section
+bool setPackedDataUpdates(Client *c, bool enable, string *ackMsg);
+
+bool setPackedLogRecords(Client *c, bool enable, string *ackMsg)
+{
+	if (enable == c->logQueue.packed)
+		return true;
+	if (enable && !c->cddID_logData) {
+		// first time enabled, set up log data CDA which the client should have already created; it is named "WASimCommander.LogData.<client_name>"
+		c->cddID_logData = g_nextClienDataId++;
+		const string cdaName(CDA_NAME_LOGDATA_PFX + c->name);
+		if FAILED(SimConnectHelper::registerDataArea(g_hSimConnect, cdaName, c->cddID_logData, c->cddID_logData, LOG_DATA_AREA_SIZE, false)) {
+			c->cddID_logData = 0;
+			*ackMsg = "Failed to set up log data area, check log messages.";
+			return false;
+		}
+		LOG_DBG << "Created CDA ID " << c->cddID_logData << " named " << quoted(cdaName) << " of size " << LOG_DATA_AREA_SIZE;
+	}
+	// send anything already queued in the current format
+	flushClientLog(c);
+	if (enable)
+		c->logQueue.block.reserve(LOG_DATA_AREA_SIZE);
+	c->logQueue.packed = enable;
+	*ackMsg = enable ? "Packed log records enabled" : "Packed log records disabled";
+	return true;
+}
+
+// forward, in Key Events section
+bool setKeyEventCoalescing(Client *c, double value, string *ackMsg);
+
+bool setClientOption(Client *c, const Command *const cmd, string *ackMsg)
+{
+	const ClientOption option = ClientOption(cmd->uData);
+	const bool enable = cmd->fData != 0.0;
+	LOG_DBG << "Setting option " << Utilities::getEnumName(option, ClientOptionNames) << " to " << cmd->fData << " for client " << c->name;
+	switch (option) {
+		case ClientOption::PackedDataUpdates:
+			return setPackedDataUpdates(c, enable, ackMsg);
+		case ClientOption::UpdateHeartbeat:
+			if (cmd->fData < 0.0) {
+				*ackMsg = "Heartbeat interval cannot be negative.";
+				return false;
+			}
+			c->updateHeartbeat = std::chrono::duration_cast<steady_clock::duration>(std::chrono::duration<double, std::milli>(cmd->fData));
+			return true;
+		case ClientOption::DeltaEpsilonHysteresis:
+			if (cmd->fData < 0.0) {
+				*ackMsg = "Hysteresis factor cannot be negative.";
+				return false;
+			}
+			c->deltaHysteresis = (float)cmd->fData;
+			return true;
+		case ClientOption::PackedLogRecords:
+			return setPackedLogRecords(c, enable, ackMsg);
+		case ClientOption::SuppressAcks:
+			c->suppressAcks = enable;
+			return true;
+		case ClientOption::CoalesceKeyEvent:
+			return setKeyEventCoalescing(c, cmd->fData, ackMsg);
+		case ClientOption::KeyEventQueue:
+			// the client starts a new write sequence each time it enables the queue
+			c->keyEventQueue = enable;
+			c->keyEventReadSeq = 0;
+			return true;
+		default:
+			*ackMsg = "Unknown option.";
+			return false;
+	}
+}
+
 bool setLogLevel(Client *c, const Command *const cmd, string *ackMsg = nullptr)
 {
 	bool ret = true;
@@ -912,45 +1690,147 @@ bool setLogLevel(Client *c, const Command *const cmd, string *ackMsg = nullptr)
 	return ret;
 }
 
-void listItems(const Client *c, const Command *const cmd)
+// Sets up the client's list data area for packed List results, if not done already.
+bool setupClientListDataArea(Client *c)
 {
-	LOG_DBG << "Got List request of type " << Utilities::getEnumName((LookupItemType)cmd->uData, LookupItemTypeNames) << " for client " << c->name;
-	Command resp(CommandId::List);
-	resp.token = cmd->token;
-	switch ((LookupItemType)cmd->uData) {
-		case LookupItemType::LocalVariable: {
-			int i = 0;
-			while (true) {
-				PCSTRINGZ varName = get_name_of_named_variable(i);
-				if (!varName)
-					break;
-				resp.uData = i++;
-				resp.setStringData(varName);
-				sendResponse(c, resp);
-			}
-			break;
-		}
-		case LookupItemType::DataRequest: {
-			for (const auto &r : c->requests) {
-				resp.uData = r.first;
-				resp.setStringData(r.second.nameOrCode);
-				sendResponse(c, resp);
-			}
-			break;
-		}
-		case LookupItemType::RegisteredEvent: {
-			for (const auto &r : c->events) {
-				resp.uData = r.first;
-				resp.setStringData(r.second.code.c_str());
-				sendResponse(c, resp);
+	if (c->cddID_listData)
+		return true;
+	// List data area is named "WASimCommander.ListData.<client_name>"; read-only for client, which should have already created it
+	c->cddID_listData = g_nextClienDataId++;
+	const string cdaName(CDA_NAME_LIST_PFX + c->name);
+	if FAILED(SimConnectHelper::registerDataArea(g_hSimConnect, cdaName, c->cddID_listData, c->cddID_listData, LIST_DATA_AREA_SIZE, false)) {
+		c->cddID_listData = 0;
+		return false;
+	}
+	LOG_DBG << "Created CDA ID " << c->cddID_listData << " named " << quoted(cdaName) << " of size " << LIST_DATA_AREA_SIZE;
+	return true;
+}
+
+// Sends any pending packed list results to the client's list data area.
+void flushListBlock(Client *c)
+{
+	vector<uint8_t> &block = c->listCursor.block;
+	if (block.size() <= sizeof(ListDataHeader))
+		return;
+	reinterpret_cast<ListDataHeader *>(block.data())->dataSize = uint16_t(block.size() - sizeof(ListDataHeader));
+	block.resize(LIST_DATA_AREA_SIZE);
+	INVOKE_SIMCONNECT(SetClientData, g_hSimConnect, c->cddID_listData, c->cddID_listData, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0UL, (DWORD)LIST_DATA_AREA_SIZE, (void *)block.data());
+	block.clear();
+}
+
+// Sends one list result item to the client, either as a List response or by adding it to the packed results block.
+void addListItem(Client *c, int32_t id, const char *name)
+{
+	ListCursor &lc = c->listCursor;
+	if (!lc.packed) {
+		sendResponse(c, Command(CommandId::List, (uint32_t)id, name, 0.0, lc.token));
+		return;
+	}
+	// names are limited to the same length as in unpacked results
+	const size_t nameLen = strnlen(name, STRSZ_CMD - 1);
+	if (lc.block.size() + sizeof(int32_t) + nameLen + 1 > LIST_DATA_AREA_SIZE)
+		flushListBlock(c);
+	if (lc.block.empty()) {
+		lc.block.resize(sizeof(ListDataHeader));
+		*reinterpret_cast<ListDataHeader *>(lc.block.data()) = ListDataHeader { lc.token, 0, 0 };
+	}
+	const size_t pos = lc.block.size();
+	lc.block.resize(pos + sizeof(int32_t) + nameLen + 1);
+	memcpy(lc.block.data() + pos, &id, sizeof(int32_t));
+	memcpy(lc.block.data() + pos + sizeof(int32_t), name, nameLen);
+	lc.block.back() = '\0';
+	++reinterpret_cast<ListDataHeader *>(lc.block.data())->itemCount;
+}
+
+// Checks if an item index is within the requested range of the current List command.
+bool isListItemInRange(const ListCursor &lc, uint32_t index) {
+	return index >= lc.start && (!lc.count || index - lc.start < lc.count);
+}
+
+// Sends the next batch of L var names for the current List command, up to the per-tick limit. Returns true when the list is complete.
+bool continueLocalVarsList(Client *c)
+{
+	ListCursor &lc = c->listCursor;
+	for (uint32_t n = 0; !g_listItemsPerTick || n < g_listItemsPerTick; ++n, ++lc.next) {
+		if (!isListItemInRange(lc, lc.next))
+			return true;
+		PCSTRINGZ varName = get_name_of_named_variable(lc.next);
+		if (!varName)
+			return true;
+		addListItem(c, (int32_t)lc.next, varName);
+	}
+	// send what we have so far
+	flushListBlock(c);
+	return false;
+}
+
+// Sends any remaining results and the final Ack for the current List command.
+void finishList(Client *c)
+{
+	const bool wasActive = c->listCursor.active;
+	if (c->listCursor.packed)
+		flushListBlock(c);
+	sendAckNak(c, CommandId::List, true, c->listCursor.token, "List results completed");
+	c->listCursor = ListCursor();
+	if (wasActive)
+		checkTriggerEventNeeded();
+}
+
+void listItems(Client *c, const Command *const cmd)
+{
+	LOG_DBG << "Got List request of type " << Utilities::getEnumName((LookupItemType)cmd->uData, LookupItemTypeNames) << " for client " << c->name << " with range " << quoted(cmd->sData);
+	if (c->listCursor.active) {
+		logAndNak(c, *cmd, ostringstream() << "A List command with token " << c->listCursor.token << " is still in progress.");
+		return;
+	}
+	ListCursor &lc = c->listCursor;
+	lc.token = cmd->token;
+	// Optional range of items to list, as "<start>[,<count>]"
+	if (cmd->sData[0] != '\0') {
+		const char *end = cmd->sData + strnlen(cmd->sData, STRSZ_CMD);
+		const from_chars_result res = from_chars(cmd->sData, end, lc.start);
+		if (res.ec == errc() && res.ptr < end && *res.ptr == ',')
+			from_chars(res.ptr + 1, end, lc.count);
+	}
+	// Packed results are written in blocks to the list data area if requested (and the area could be set up), otherwise each item is sent as a separate response.
+	lc.packed = cmd->fData != 0.0 && setupClientListDataArea(c);
+	if (cmd->fData != 0.0 && !lc.packed)
+		LOG_WRN << "Could not set up list data area for client " << c->name << ", sending unpacked List results.";
+	if (lc.packed)
+		lc.block.reserve(LIST_DATA_AREA_SIZE);
+
+	uint32_t index = 0;
+	switch ((LookupItemType)cmd->uData) {
+		case LookupItemType::LocalVariable: {
+			// this could be a long list, so it may be continued on subsequent ticks
+			lc.next = lc.start;
+			if (continueLocalVarsList(c))
+				break;
+			lc.active = true;
+			if (!g_triggersRegistered)
+				resumeTriggerEvent();
+			return;
+		}
+		case LookupItemType::DataRequest: {
+			for (const auto &r : c->requests) {
+				if (isListItemInRange(lc, index++))
+					addListItem(c, (int32_t)r.first, r.second.nameOrCode);
+			}
+			break;
+		}
+		case LookupItemType::RegisteredEvent: {
+			for (const auto &r : c->events) {
+				if (isListItemInRange(lc, index++))
+					addListItem(c, (int32_t)r.first, r.second.code.c_str());
 			}
 			break;
 		}
 		default:
+			c->listCursor = ListCursor();
 			logAndNak(c, *cmd, ostringstream() << "Unknown LookupItemType " << Utilities::getEnumName((LookupItemType)cmd->uData, LookupItemTypeNames) << " (" << cmd->uData << ") for List command.");
 			return;
 	}
-	sendAckNak(c, CommandId::List, true, cmd->token, "List results completed");
+	finishList(c);
 }
 
 void lookup(const Client *c, const Command *const cmd)
@@ -971,20 +1851,16 @@ void lookup(const Client *c, const Command *const cmd)
 			itemId = getVariableId('T', name);
 			break;
 		case LookupItemType::UnitType:
-			itemId = get_units_enum(name);
+			itemId = getUnitId(name);
 			break;
 		case LookupItemType::KeyEventId:
 			itemId = Utilities::getKeyEventId(name);    // Intellicode erroneous error flag
 			break;
 		case LookupItemType::DataRequest:
-			for (const auto &r : c->requests)
-				if (!strcmp(name, r.second.nameOrCode))
-					itemId = (int)r.first;
+			itemId = findNameIndex(c->requestNameIndex, name);
 			break;
 		case LookupItemType::RegisteredEvent:
-			for (const auto &e : c->events)
-				if (!strcmp(name, e.second.code.c_str()))
-					itemId = (int)e.first;
+			itemId = findNameIndex(c->eventCodeIndex, name);
 			break;
 		default:
 			logAndNak(c, *cmd, ostringstream() << "Unknown LookupItemType: " << cmd->uData);
@@ -1004,9 +1880,26 @@ void execCalculatorCode(const Client *c, const Command *const cmd)
 	}
 	const CalcResultType resultType = CalcResultType(cmd->uData);
 	calcResult_t res = calcResult_t { resultType, STRSZ_CMD };
-	if (!execCalculatorCode(cmd->sData, res))
+	// Use compiled code if the same code was already compiled for a data request, registered event, or a repeated Exec command (see note in addOrUpdateRequest() about compiling code for format_calculator_string()).
+	// Other code is only compiled and cached once it has been run a few times, since compiling costs more than a single execution and a lot of it is unique, eg. the code generated by setVariable() for each value.
+	const string *bytecode = nullptr;
+	string compiled {};
+	if (resultType != CalcResultType::Formatted && g_compiledCodeCacheSize) {
+		const string_view code(cmd->sData);
+		if (!(bytecode = findCompiledCalculatorCode(code))) {
+			if (isRepeatedExecCode(code))
+				compileCalculatorCode(code, compiled);  // also counts the cache miss
+			else
+				++g_compiledCodeMisses;
+			bytecode = &compiled;
+		}
+	}
+	const bool precompiled = bytecode && !bytecode->empty();
+	if (!execCalculatorCode(precompiled ? bytecode->c_str() : cmd->sData, res, precompiled))
 		return logAndNak(c, *cmd, ostringstream() << (resultType == CalcResultType::Formatted ? "format_calculator_string() returned error status" : "execute_calculator_code() returned error status"));
 
+	if (resultType == CalcResultType::None && (cmd->commandId == CommandId::Exec ? acksSuppressed(c) : isAckSuppressed(c, cmd->commandId)))
+		return;
 	Command resp(CommandId::Ack, (uint32_t)cmd->commandId);
 	resp.token = cmd->token;
 	if (resultType != CalcResultType::None) {
@@ -1103,14 +1996,9 @@ void setVariable(const Client *c, const Command *const cmd)
 
 #pragma region Data Subscription Requests  ----------------------------------------------
 
-// Perform lookup, comparison, and storage of an individual data DataRequest. Called from tick() loop or upon demand by Client.
-bool updateRequestValue(const Client *c, TrackedRequest *tr, bool compareCheck = true, string *ackMsg = nullptr)
+// Get the current value of a request by running its calculator code or reading the named variable. Disables further updates on errors.
+bool evaluateRequest(TrackedRequest *tr, calcResult_t &res, string *ackMsg)
 {
-	if (!tr)
-		return false;
-
-	calcResult_t res = calcResult_t { tr->calcResultType, tr->dataSize, tr->variableId, tr->unitId, tr->simVarIndex, tr->nameOrCode };
-
 	if (tr->requestType == RequestType::Calculated) {
 		if (!execCalculatorCode(tr->calcBytecode.empty() ? tr->nameOrCode : tr->calcBytecode.c_str(), res, !tr->calcBytecode.empty())) {
 			// calculation error, disable further updates
@@ -1132,77 +2020,373 @@ bool updateRequestValue(const Client *c, TrackedRequest *tr, bool compareCheck =
 			return false;
 		}
 	}  // end if named var
+	return true;
+}
+
+// Returns the signed difference between two numeric values, interpreted according to a DATA_TYPE_* value type.
+// Returns NaN for values which do not use one of the numeric types (same as SimConnect, which only applies deltaEpsilon to typed values).
+double valueDelta(uint32_t valueSize, const void *data, const void *prev)
+{
+	switch (valueSize) {
+		case DATA_TYPE_DOUBLE:
+			return *(const double *)data - *(const double *)prev;
+		case DATA_TYPE_FLOAT:
+			return (double)*(const float *)data - (double)*(const float *)prev;
+		case DATA_TYPE_INT32:
+			return (double)*(const int32_t *)data - (double)*(const int32_t *)prev;
+		case DATA_TYPE_INT8:
+			return (double)*(const int8_t *)data - (double)*(const int8_t *)prev;
+		case DATA_TYPE_INT16:
+			return (double)*(const int16_t *)data - (double)*(const int16_t *)prev;
+		case DATA_TYPE_INT64:
+			return (double)*(const int64_t *)data - (double)*(const int64_t *)prev;
+		default:
+			return std::numeric_limits<double>::quiet_NaN();
+	}
+}
+
+// Returns the signed difference between a new numeric value of a request and a previous one. For indexed-range requests this is the largest change of any element.
+double requestValueDelta(const TrackedRequest *tr, const void *data, const uint8_t *prev)
+{
+	if (tr->simVarIndexCount < 2)
+		return valueDelta(tr->valueSize, data, prev);
+	const uint32_t size = Utilities::getActualValueSize(tr->valueSize);
+	double delta = 0.0;
+	for (uint32_t i = 0, offset = 0; i < tr->simVarIndexCount; ++i, offset += size) {
+		const double d = valueDelta(tr->valueSize, (const uint8_t *)data + offset, prev + offset);
+		if (std::isnan(d))
+			return d;
+		if (std::fabs(d) > std::fabs(delta))
+			delta = d;
+	}
+	return delta;
+}
+
+// Returns the maximum time between value updates of a request, which is the request's own maxUpdateInterval if set or otherwise the client's heartbeat setting; zero if disabled.
+steady_clock::duration requestHeartbeat(const Client *c, const TrackedRequest *tr)
+{
+	if (tr->maxUpdateInterval)
+		return milliseconds(tr->maxUpdateInterval);
+	return c->updateHeartbeat;
+}
 
-	if (!res.resultSize || res.resultMemberIndex < 0) {
+// Returns the statistics counters of a request, which for a Group member are the group's.
+StatsRecord &requestStats(TrackedRequest *tr)
+{
+	return tr->group ? tr->group->stats : tr->stats;
+}
+
+// Checks if a new request value differs enough from the previously sent value `prev` to be sent to the client, based on the request's deltaEpsilon and client's filtering options.
+// `lastDeltaSign` is the direction of the last sent change, which is updated if the new value should be sent.
+bool valueChanged(Client *c, TrackedRequest *tr, const void *data, const uint8_t *prev, int8_t &lastDeltaSign)
+{
+	if (!memcmp(data, prev, tr->dataSize)) {
+		LOG_TRC << "updateRequestValue(" << tr->requestId << "): Result values are equal, skipping update";
+		return false;
+	}
+	if (tr->deltaEpsilon <= 0.0f)
+		return true;
+	const double delta = requestValueDelta(tr, data, prev);
+	if (std::isnan(delta))
+		return true;
+	const int8_t sign = delta < 0.0 ? -1 : 1;
+	// for integer value types, only the integer part of the epsilon value is considered (same as SimConnect)
+	double threshold = (tr->valueSize == DATA_TYPE_DOUBLE || tr->valueSize == DATA_TYPE_FLOAT) ? tr->deltaEpsilon : std::trunc(tr->deltaEpsilon);
+	// a change in the opposite direction of the last one needs to be larger by the hysteresis factor, to avoid sending values jittering around a point
+	if (c->deltaHysteresis > 0.0f && lastDeltaSign && sign != lastDeltaSign)
+		threshold += threshold * c->deltaHysteresis;
+	if (std::fabs(delta) > threshold) {
+		lastDeltaSign = sign;
+		return true;
+	}
+	++requestStats(tr).suppressedCount;
+	++c->stats.suppressedCount;
+	++g_suppressedWrites;
+	LOG_TRC << "updateRequestValue(" << tr->requestId << "): Result value change of " << delta << " is within deltaEpsilon " << threshold << ", skipping update";
+	return false;
+}
+
+// Checks if a new request value should be sent to the client, based on the last sent value, the request's deltaEpsilon, and client's filtering options.
+bool shouldWriteRequestValue(Client *c, TrackedRequest *tr, const void *data)
+{
+	if (!tr->dataValid)
+		return true;
+	const steady_clock::duration heartbeat = requestHeartbeat(c, tr);
+	if (heartbeat.count() && steady_clock::now() - tr->lastWrite >= heartbeat)
+		return true;
+	return valueChanged(c, tr, data, tr->data.data(), tr->lastDeltaSign);
+}
+
+// Adds one timed operation to a set of statistics counters.
+void addTiming(uint64_t &count, uint64_t &total, uint32_t &max, const steady_clock::duration &elapsed)
+{
+	const uint32_t us = (uint32_t)std::chrono::duration_cast<microseconds>(elapsed).count();
+	++count;
+	total += us;
+	if (us > max)
+		max = us;
+}
+
+// Calls evaluateRequest() and updates the request and client statistics.
+bool evaluateRequestTimed(Client *c, TrackedRequest *tr, calcResult_t &res, string *ackMsg)
+{
+	StatsRecord &stats = requestStats(tr);
+	if (!g_collectTimingStats) {
+		++stats.evalCount;
+		++c->stats.evalCount;
+		return evaluateRequest(tr, res, ackMsg);
+	}
+	const steady_clock::time_point start = steady_clock::now();
+	const bool ret = evaluateRequest(tr, res, ackMsg);
+	const steady_clock::duration elapsed = steady_clock::now() - start;
+	addTiming(stats.evalCount, stats.evalTimeTotal, stats.evalTimeMax, elapsed);
+	addTiming(c->stats.evalCount, c->stats.evalTimeTotal, c->stats.evalTimeMax, elapsed);
+	return ret;
+}
+
+// Returns a pointer to a numeric result value in the binary representation of the request's value type. Converted values are stored in the request's own buffer,
+// since the result may be shared with other requests through the evaluation cache.
+const void *convertNumericValue(TrackedRequest *tr, const double &fVal)
+{
+	float &f32 = tr->convertedValue.f32;
+	int32_t &i32 = tr->convertedValue.i32;
+	int64_t &i64 = tr->convertedValue.i64;
+	// convert the value if necessary for proper binary representation
+	switch (tr->valueSize) {
+		// ordered most to least likely
+		case DATA_TYPE_DOUBLE:
+		case sizeof(double):
+			return &fVal;
+		case DATA_TYPE_FLOAT:
+		case sizeof(float):
+			return &(f32 = (float)fVal);
+		case DATA_TYPE_INT32:
+		case 3:
+			return &(i32 = (int32_t)fVal);
+		case DATA_TYPE_INT8:
+		case 1:
+			return &(i32 = (int8_t)fVal);
+		case DATA_TYPE_INT16:
+		case 2:
+			return &(i32 = (int16_t)fVal);
+		case DATA_TYPE_INT64:
+			// the widest integer any gauge API function returns is 48b (for token/MODULE_VAR) so 53b precision is OK here
+			return &(i64 = (int64_t)fVal);
+		default:
+			return &fVal;
+	}
+}
+
+// Evaluates each SimVar index of an indexed-range request, using the already resolved variable and unit IDs, and returns a pointer to the packed array of values, or nullptr on error.
+const void *getIndexedRangeValueData(Client *c, TrackedRequest *tr, string *ackMsg)
+{
+	calcResult_t &own = tr->result;
+	const uint32_t size = Utilities::getActualValueSize(tr->valueSize);
+	uint8_t *dest = tr->rangeData.data();
+	for (uint32_t i = 0; i < tr->simVarIndexCount; ++i, dest += size) {
+		own.reset(tr->calcResultType, size, tr->variableId, tr->unitId, uint8_t(tr->simVarIndex + i), tr->nameOrCode, false);
+		if (!evaluateRequestTimed(c, tr, own, ackMsg))
+			return nullptr;
+		memcpy(dest, convertNumericValue(tr, own.fVal), size);
+	}
+	return tr->rangeData.data();
+}
+
+// Evaluates a request and returns a pointer to the result value data in the request's value type and size, or nullptr on error.
+// If `useCache` is true then the result may come from, or be stored in, the evaluation cache of the current tick.
+// The data stays valid until the request, or the request whose result was cached, is evaluated again.
+const void *getRequestValueData(Client *c, TrackedRequest *tr, string *ackMsg, bool useCache)
+{
+	if (tr->simVarIndexCount > 1)
+		return getIndexedRangeValueData(c, tr, ackMsg);
+
+	// The request's own result buffer is re-used for each evaluation; a string result is only stored when one was actually requested.
+	// The buffer is only reset right before evaluating, since the cache may hold a pointer to it, eg. when the request is evaluated again in the same tick as part of a Group.
+	calcResult_t &own = tr->result;
+	const calcResult_t *res = &own;
+
+	if (useCache && g_evalCacheEnabled) {
+		const EvalCacheKey key(*tr);
+		if (const calcResult_t *cached = g_evalCache.find(key)) {
+			res = cached;
+			++g_evalCacheHits;
+		}
+		else {
+			own.reset(tr->calcResultType, tr->dataSize, tr->variableId, tr->unitId, tr->simVarIndex, tr->nameOrCode, false);
+			if (!evaluateRequestTimed(c, tr, own, ackMsg))
+				return nullptr;
+			g_evalCache.insert(key, &own);
+			++g_evalCacheMisses;
+		}
+	}
+	else {
+		own.reset(tr->calcResultType, tr->dataSize, tr->variableId, tr->unitId, tr->simVarIndex, tr->nameOrCode, false);
+		if (!evaluateRequestTimed(c, tr, own, ackMsg))
+			return nullptr;
+	}
+
+	if (!res->resultSize || res->resultMemberIndex < 0) {
 		if (ackMsg)
 			*ackMsg = "Got invalid result size and/or index";
-		LOG_ERR << "updateRequestValue(" << tr->requestId << ") got invalid result size: " << res.resultSize << "; and/or index: " << (int)res.resultMemberIndex;
-		return false;
+		LOG_ERR << "updateRequestValue(" << tr->requestId << ") got invalid result size: " << res->resultSize << "; and/or index: " << (int)res->resultMemberIndex;
+		return nullptr;
 	}
 	//if (res.resultSize > tr->dataSize) {
 	//	LOG_ERR << "updateRequestValue(" << tr->requestId << "): Result size too large! Result size: " << res.resultSize << " > Request size: " << tr->dataSize;
 	//	return false;
 	//}
 
-	void *data = nullptr;  // pointer to result data value
-	float f32;    // buffer
-	int64_t i64;  // buffer
-	switch (res.resultMemberIndex) {
+	const void *data = nullptr;  // pointer to result data value
+	switch (res->resultMemberIndex) {
 		// double
 		case 0:
-			// convert the value if necessary for proper binary representation
-			switch (tr->valueSize) {
-				// ordered most to least likely
-				case DATA_TYPE_DOUBLE:
-				case sizeof(double):
-					data = &res.fVal;
-					break;
-				case DATA_TYPE_FLOAT:
-				case sizeof(float):
-					data = &(f32 = (float)res.fVal);
-					break;
-				case DATA_TYPE_INT32:
-				case 3:
-					data = &(res.iVal = (int32_t)res.fVal);
-					break;
-				case DATA_TYPE_INT8:
-				case 1:
-					data = &(res.iVal = (int8_t)res.fVal);
-					break;
-				case DATA_TYPE_INT16:
-				case 2:
-					data = &(res.iVal = (int16_t)res.fVal);
-					break;
-				case DATA_TYPE_INT64:
-					// the widest integer any gauge API function returns is 48b (for token/MODULE_VAR) so 53b precision is OK here
-					data = &(i64 = (int64_t)res.fVal);
-					break;
-				default:
-					data = &res.fVal;
-					break;
-			}
+			data = convertNumericValue(tr, res->fVal);
 			break;
 		// int32
 		case 1:
-			data = &res.iVal;
+			data = &res->iVal;
 			break;
 		// string
 		case 2:
-			data = (void *)res.sVal.data();
+			data = res->sVal.data();
 			break;
 	}
+	return data;
+}
 
-	if (compareCheck && tr->compareCheck && !memcmp(data, tr->data.data(), tr->dataSize)) {
-		LOG_TRC << "updateRequestValue(" << tr->requestId << "): Result values are equal, skipping update";
+// Evaluates the members of a Group type request and writes the record if any of the member values changed. Each member's last sent value is kept in
+// the group record and compared against there, so unchanged members keep their previous value in the record. The group's update interval limits apply
+// to the whole record: changes within its minUpdateInterval are collected in the record (and changed members bitmap) and written when the interval ends.
+bool updateGroupValue(Client *c, TrackedRequest *gr, bool compareCheck, bool useCache)
+{
+	uint8_t *const record = gr->data.data();
+	uint8_t *const bitmap = gr->groupBitmap ? record : nullptr;
+	const uint32_t bitmapSize = bitmap ? Utilities::getGroupBitmapSize(gr->groupMembers.size()) : 0;
+	// the bitmap marks all members which changed since the last write
+	if (bitmap && !gr->pendingWrite)
+		memset(bitmap, 0, bitmapSize);
+	const steady_clock::time_point now = steady_clock::now();
+	const steady_clock::duration heartbeat = requestHeartbeat(c, gr);
+	const bool compare = compareCheck && gr->compareCheck;
+	bool changed = gr->pendingWrite || !compare || !gr->dataValid || (heartbeat.count() && now - gr->lastWrite >= heartbeat);
+
+	uint8_t *slot = record + bitmapSize;
+	for (size_t i = 0, e = gr->groupMembers.size(); i < e; slot += gr->groupMembers[i++].dataSize) {
+		TrackedRequest &m = gr->groupMembers[i];
+		const void *data = getRequestValueData(c, &m, nullptr, useCache);
+		if (!data || (compare && m.compareCheck && m.dataValid && !valueChanged(c, &m, data, slot, m.lastDeltaSign)))
+			continue;
+		memcpy(slot, data, m.dataSize);
+		m.dataValid = true;
+		if (bitmap)
+			bitmap[i / 8] |= uint8_t(1 << (i % 8));
+		changed = true;
+	}
+	if (!changed)
+		return true;
+
+	// a change within the minimum interval since the last write is held back; the group is checked again when the interval ends (see nextRequestUpdateTime())
+	if (compareCheck && gr->minUpdateInterval && gr->dataValid && now - gr->lastWrite < milliseconds(gr->minUpdateInterval)) {
+		gr->pendingWrite = true;
+		LOG_TRC << "updateGroupValue(" << gr->requestId << "): Member values changed within minUpdateInterval, deferring update";
+		return true;
+	}
+	gr->pendingWrite = false;
+	gr->dataValid = true;
+	gr->lastWrite = now;
+	LOG_TRC << "updateGroupValue(" << gr->requestId << "): result: " << *gr;
+	writeRequestData(c, gr, record);
+	return true;
+}
+
+bool updateRequestValue(Client *c, TrackedRequest *tr, bool compareCheck = true, string *ackMsg = nullptr, bool useCache = false)
+{
+	if (!tr)
+		return false;
+	if (tr->requestType == RequestType::Group)
+		return updateGroupValue(c, tr, compareCheck, useCache);
+
+	const void *data = getRequestValueData(c, tr, ackMsg, useCache);
+	if (!data)
+		return false;
+
+	tr->pendingWrite = false;
+	if (compareCheck && tr->compareCheck && !shouldWriteRequestValue(c, tr, data))
+		return true;
+	const bool timed = c->updateHeartbeat.count() || tr->minUpdateInterval || tr->maxUpdateInterval;
+	const steady_clock::time_point now = timed ? steady_clock::now() : steady_clock::time_point();
+	// a change within the minimum interval since the last write is held back; the request is checked again when the interval ends (see nextRequestUpdateTime())
+	if (compareCheck && tr->minUpdateInterval && tr->dataValid && now - tr->lastWrite < milliseconds(tr->minUpdateInterval)) {
+		tr->pendingWrite = true;
+		LOG_TRC << "updateRequestValue(" << tr->requestId << "): Result value changed within minUpdateInterval, deferring update";
 		return true;
 	}
 	memcpy(tr->data.data(), data, tr->dataSize);   // Intellicode erroneous error flag
+	tr->dataValid = true;
+	if (timed)
+		tr->lastWrite = now;
 	LOG_TRC << "updateRequestValue(" << tr->requestId << "): result: " << *tr;
 
 	writeRequestData(c, tr, data);
 	return true;
 }
 
+// Returns the time between recurring updates of a request, or zero if it should be updated on every tick.
+steady_clock::duration requestUpdateInterval(const TrackedRequest *tr)
+{
+	if (tr->period == UpdatePeriod::Millisecond)
+		return milliseconds(tr->interval);
+	if (tr->period == UpdatePeriod::Tick && tr->interval > 0)
+		return milliseconds((tr->interval + 1) * TICK_PERIOD_MS);
+	return steady_clock::duration::zero();
+}
+
+// Returns the time of the first recurring update of a request, offset by some number of ticks within its update interval, so that
+// requests with the same interval which are added at the same time do not all become due on the same tick.
+steady_clock::time_point staggeredUpdateTime(const TrackedRequest *tr, const steady_clock::time_point &now)
+{
+	if (!g_staggerUpdates)
+		return now;
+	const int64_t slots = requestUpdateInterval(tr) / milliseconds(TICK_PERIOD_MS);
+	if (slots < 2)
+		return now;
+	return now + milliseconds(TICK_PERIOD_MS) * (g_nextPhaseSlot++ % slots);
+}
+
+// Returns the time of the next recurring update of a request following a scheduled one which was due at `due`. This is the next regular update interval
+// unless a deferred change needs to be sent, or a keep-alive update is due, sooner than that.
+steady_clock::time_point nextRequestUpdateTime(const TrackedRequest *tr, const steady_clock::time_point &due, const steady_clock::time_point &now)
+{
+	const steady_clock::duration interval = requestUpdateInterval(tr);
+	if (!interval.count())
+		return g_tpNextTick;
+	// keep the update phase relative to the scheduled time, unless we've fallen behind by more than a whole interval
+	steady_clock::time_point next = due + interval;
+	if (next <= now)
+		next = now + interval;
+	steady_clock::time_point deadline = next;
+	if (tr->pendingWrite)
+		deadline = tr->lastWrite + milliseconds(tr->minUpdateInterval);
+	else if (tr->maxUpdateInterval && tr->dataValid && tr->compareCheck)
+		deadline = tr->lastWrite + milliseconds(tr->maxUpdateInterval);
+	if (deadline < next)
+		next = std::max(deadline, g_tpNextTick);
+	return next;
+}
+
+// Queue the next update of a recurring request at the given time, invalidating any previously queued entry for it.
+// Requests which do not need periodic updates are just marked as unscheduled.
+void scheduleRequestUpdate(const Client *c, TrackedRequest *tr, const steady_clock::time_point &when)
+{
+	if (tr->period < UpdatePeriod::Tick) {
+		tr->scheduleSeq = 0;
+		return;
+	}
+	tr->nextUpdate = when;
+	tr->scheduleSeq = g_nextScheduleSeq++;
+	g_updateSchedule.push(ScheduledUpdate { when, tr->scheduleSeq, c->clientId, tr->requestId, priorityClass(tr->priority) });
+}
+
 bool removeRequest(Client *c, const uint32_t requestId)
 {
 	const TrackedRequest *tr = findClientRequest(c, requestId);
@@ -1211,6 +2395,7 @@ bool removeRequest(Client *c, const uint32_t requestId)
 		return false;
 	}
 	removeClientVariableDataArea(tr);
+	removeNameIndex(c->requestNameIndex, tr->nameOrCode, tr->requestId);
 	c->requests.erase(tr->requestId);
 	LOG_DBG << "Deleted DataRequest ID " << requestId;
 	sendAckNak(c, CommandId::Subscribe, true, requestId);
@@ -1219,6 +2404,73 @@ bool removeRequest(Client *c, const uint32_t requestId)
 	return true;
 }
 
+// Looks up the variable and unit IDs of a Named request, or compiles the code of a Calculated one. Returns false with a message in `error` if
+// the request can not be evaluated; lookup failures which the request can do without are only logged as warnings.
+bool prepareRequest(TrackedRequest *tr, ostringstream &error)
+{
+	if (tr->requestType == RequestType::Named) {
+		// Look up variable ID if needed.
+		if (tr->variableId < 0) {
+			tr->variableId = getVariableId(tr->varTypePrefix, tr->nameOrCode);
+			if (tr->variableId < 0) {
+				if (tr->varTypePrefix != 'T') {
+					error << "Variable named " << quoted(tr->nameOrCode) << " was not found";
+					return false;
+				}
+				LOG_WRN << "Warning in DataRequest ID " << tr->requestId << ": Token variable named " << quoted(tr->nameOrCode) << " was not found. Will fall back to initialize_var_by_name().";
+			}
+		}
+		// look up unit ID if we don't have one already
+		if (tr->unitId < 0 && tr->unitName[0] != '\0') {
+			tr->unitId = getUnitId(tr->unitName);
+			if (tr->unitId < 0) {
+				if (tr->varTypePrefix == 'A') {
+					error << "Unit named " << quoted(tr->unitName) << " was not found";
+					return false;
+				}
+				// maybe an L var... unit is not technically required.
+				LOG_WRN << "Warning in DataRequest ID " << tr->requestId << ": Unit named " << quoted(tr->unitName) << " was not found, no unit type will be used.";
+			}
+		}
+	}
+	// calculated value, update compiled string if needed
+	// NOTE: compiling code for format_calculator_string() doesn't seem to work as advertised in the docs, see:
+	//   https://devsupport.flightsimulator.com/t/gauge-calculator-code-precompile-with-code-meant-for-format-calculator-string-reports-format-errors/4457
+	else if (tr->requestType == RequestType::Calculated && tr->calcResultType != CalcResultType::Formatted && tr->calcBytecode.empty()) {
+		// assume the command has changed and re-compile
+		if (!compileCalculatorCode(tr->nameOrCode, tr->calcBytecode))
+			LOG_WRN << "Calculator string compilation failed for request ID " << tr->requestId << ", will use original code: " << quoted(tr->nameOrCode);
+	}
+	return true;
+}
+
+// Parses the member definitions of a Group type request and prepares them for evaluation. The members have no data areas of their own, their values
+// are written at consecutive offsets of the group record, following the changed members bitmap if one is used. Sends a Nak and returns false on error.
+bool getGroupMembers(Client *c, const DataRequest *const req, vector<TrackedRequest> &members, bool &bitmap, const Command &resp)
+{
+	vector<DataRequest> defs;
+	string error;
+	if (!Utilities::parseGroupMembers(*req, defs, bitmap, error)) {
+		logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": " << error);
+		return false;
+	}
+	members.reserve(defs.size());
+	for (size_t i = 0; i < defs.size(); ++i) {
+		TrackedRequest &m = members.emplace_back(defs[i], 0);
+		ostringstream err;
+		if (!prepareRequest(&m, err)) {
+			logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": Group member " << i + 1 << ": " << err.str());
+			return false;
+		}
+	}
+	const uint32_t recordSize = Utilities::getGroupRecordSize(defs, bitmap);
+	if (recordSize > Utilities::getActualValueSize(req->valueSize)) {
+		logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": Value size " << Utilities::getActualValueSize(req->valueSize) << " is too small for group record size " << recordSize);
+		return false;
+	}
+	return true;
+}
+
 // returns true if request has been scheduled or removed
 bool addOrUpdateRequest(Client *c, const DataRequest *const req)
 {
@@ -1236,22 +2488,65 @@ bool addOrUpdateRequest(Client *c, const DataRequest *const req)
 		logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": Parameter 'nameOrCode' cannot be empty.");
 		return false;
 	}
+	// a name/code which is not terminated inside its buffer most likely comes from an older client, which used the trailing bytes for a longer string
+	if (req->nameOrCode[STRSZ_REQ - 1] != '\0') {
+		logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": Parameter 'nameOrCode' exceeds the maximum length of " << STRSZ_REQ - 1 << " characters.");
+		return false;
+	}
+
+	// indexed-range requests read a numeric SimVar at consecutive indexes
+	if (req->simVarIndexCount > 1) {
+		const uint32_t elementSize = Utilities::getActualValueSize(req->valueSize);
+		if (req->requestType != RequestType::Named || req->varTypePrefix != 'A' || !strcasecmp(req->unitName, "string") || !elementSize || elementSize > 8) {
+			logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": Indexed-range requests require a named SimVar with a numeric value type.");
+			return false;
+		}
+		if ((uint32_t)req->simVarIndex + req->simVarIndexCount - 1 > UINT8_MAX) {
+			logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": SimVar index range " << (uint16_t)req->simVarIndex << " + " << (uint16_t)req->simVarIndexCount << " exceeds the maximum index " << UINT8_MAX);
+			return false;
+		}
+	}
+
+	if ((size_t)req->priority >= REQUEST_PRIORITY_CLASSES) {
+		logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": Invalid priority value " << (uint16_t)req->priority);
+		return false;
+	}
+
+	// update interval limits only apply to recurring updates, and the minimum can't be longer than the maximum
+	if (req->minUpdateInterval || req->maxUpdateInterval) {
+		if (req->period < UpdatePeriod::Tick || req->period > UpdatePeriod::Millisecond) {
+			logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": Update intervals require a recurring update period (Tick or Millisecond).");
+			return false;
+		}
+		if (req->minUpdateInterval && req->maxUpdateInterval && req->minUpdateInterval > req->maxUpdateInterval) {
+			logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": minUpdateInterval " << req->minUpdateInterval << " is greater than maxUpdateInterval " << req->maxUpdateInterval);
+			return false;
+		}
+	}
 
 	TrackedRequest *tr = findClientRequest(c, req->requestId);
 	const bool isNewRequest = (tr == nullptr);
-	const uint32_t actualValSize = Utilities::getActualValueSize(req->valueSize);
+	const uint32_t actualValSize = Utilities::getRequestDataSize(*req);
+	const DWORD definitionSize = Utilities::getRequestDefinitionSize(*req);
+
+	// group requests need valid member definitions, and a value size which fits all the member values
+	vector<TrackedRequest> groupMembers;
+	bool groupBitmap = false;
+	if (req->requestType == RequestType::Group && !getGroupMembers(c, req, groupMembers, groupBitmap, resp))
+		return false;
 
 	if (isNewRequest) {
 		// New request
 
 		const SIMCONNECT_CLIENT_DATA_DEFINITION_ID newDataId = g_nextClienDataId++;
 		// create a new data area and add definition
-		if (!registerClientVariableDataArea(c, req->requestId, newDataId, actualValSize, req->valueSize)) {
+		if (!registerClientVariableDataArea(c, req->requestId, newDataId, actualValSize, definitionSize)) {
 			logAndNak(c, resp, ostringstream()  << "Error in DataRequest ID " << req->requestId << ": Failed to create ClientDataDefinition, check log messages.");
 			return false;
 		}
 		// this may change the request from a named to a calculated type for vars/string types which don't have native gauge API access functions.
 		tr = &c->requests.emplace(piecewise_construct, forward_as_tuple(req->requestId), forward_as_tuple(*req, newDataId)).first->second;  // no try_emplace?
+		c->requestNameIndex.emplace(tr->nameOrCode, tr->requestId);
 	}
 	else {
 		// Existing request
@@ -1268,62 +2563,32 @@ bool addOrUpdateRequest(Client *c, const DataRequest *const req)
 				return false;
 			}
 			// add definition
-			if FAILED(SimConnectHelper::addClientDataDefinition(g_hSimConnect, tr->dataId, req->valueSize)) {
+			if FAILED(SimConnectHelper::addClientDataDefinition(g_hSimConnect, tr->dataId, definitionSize)) {
 				logAndNak(c, resp, ostringstream() << "Error in DataRequest ID " << req->requestId << ": Failed to create ClientDataDefinition, check log messages.");
 				return false;
 			}
 		}
 		// update the tracked request from new request data. This resets lookup IDs or the "compiled" flag if the name/code/unit changes.
+		removeNameIndex(c->requestNameIndex, tr->nameOrCode, tr->requestId);
 		*tr = *req;
+		c->requestNameIndex.emplace(tr->nameOrCode, tr->requestId);
+	}
+	tr->groupMembers = std::move(groupMembers);
+	tr->groupBitmap = groupBitmap;
+	tr->rangeData.resize(tr->simVarIndexCount > 1 ? tr->dataSize : 0);
+	// the members' statistics are counted in the group's, and a new set of members starts a new record
+	if (tr->requestType == RequestType::Group) {
+		for (TrackedRequest &m : tr->groupMembers)
+			m.group = tr;
+		tr->dataValid = tr->pendingWrite = false;
+		std::fill(tr->data.begin(), tr->data.end(), 0);
 	}
 
 	// lookups and compiling
-	if (tr->requestType == RequestType::Named) {
-		// Look up variable ID if needed.
-		if (tr->variableId < 0) {
-			tr->variableId = getVariableId(tr->varTypePrefix, tr->nameOrCode);
-			if (tr->variableId < 0) {
-				if (tr->varTypePrefix == 'T') {
-					LOG_WRN << "Warning in DataRequest ID " << req->requestId << ": Token variable named " << quoted(tr->nameOrCode) << " was not found. Will fall back to initialize_var_by_name().";
-				}
-				else {
-					LOG_ERR << "Error in DataRequest ID " << req->requestId << ": Variable named " << quoted(tr->nameOrCode) << " was not found, disabling updates.";
-					tr->period = UpdatePeriod::Never;
-				}
-			}
-		}
-		// look up unit ID if we don't have one already
-		if (tr->unitId < 0 && tr->unitName[0] != '\0') {
-			tr->unitId = get_units_enum(tr->unitName);
-			if (tr->unitId < 0) {
-				if (tr->varTypePrefix == 'A') {
-					LOG_ERR << "Error in DataRequest ID " << req->requestId << ": Unit named " << quoted(tr->unitName) << " was not found, disabling updates.";
-					tr->period = UpdatePeriod::Never;
-				}
-				// maybe an L var... unit is not technically required.
-				else {
-					LOG_WRN << "Warning in DataRequest ID " << req->requestId << ": Unit named " << quoted(tr->unitName) << " was not found, no unit type will be used.";
-				}
-			}
-		}
-	}
-	// calculated value, update compiled string if needed
-	// NOTE: compiling code for format_calculator_string() doesn't seem to work as advertised in the docs, see:
-	//   https://devsupport.flightsimulator.com/t/gauge-calculator-code-precompile-with-code-meant-for-format-calculator-string-reports-format-errors/4457
-	else if (tr->calcResultType != CalcResultType::Formatted && tr->calcBytecode.empty()) {
-		// assume the command has changed and re-compile
-		PCSTRINGZ pCompiled = nullptr;
-		UINT32 pCompiledSize = 0;
-		const bool ok = gauge_calculator_code_precompile(&pCompiled, &pCompiledSize, tr->nameOrCode);
-		if (ok && pCompiled && pCompiledSize > 0) {
-			tr->calcBytecode = string(pCompiled, pCompiledSize);
-			// DO NOT try to log the compiled code as a string -- it's byte code now and may crash the logger
-			LOG_DBG << "Got compiled calculator string with size " << pCompiledSize << ": " << Utilities::byteArrayToHex(pCompiled, pCompiledSize);
-		}
-		else {
-			LOG_WRN << "Calculator string compilation failed. gauge_calculator_code_precompile() returned: " << boolalpha << ok
-				<< " for request ID " << tr->requestId << ". Size: " << pCompiledSize << "; Result null ? " << (pCompiled == nullptr) << "; Original code : " << quoted(tr->nameOrCode);
-		}
+	ostringstream error;
+	if (!prepareRequest(tr, error)) {
+		LOG_ERR << "Error in DataRequest ID " << req->requestId << ": " << error.str() << ", disabling updates.";
+		tr->period = UpdatePeriod::Never;
 	}
 
 	sendAckNak(c, resp, true);
@@ -1340,6 +2605,8 @@ bool addOrUpdateRequest(Client *c, const DataRequest *const req)
 		else if (tr->period == UpdatePeriod::Once)
 			tr->interval = 1;
 	}
+	// (re)schedule recurring updates starting with the next tick (plus any stagger offset), or mark as unscheduled
+	scheduleRequestUpdate(c, tr, staggeredUpdateTime(tr, steady_clock::now()));
 
 	LOG_DBG << (isNewRequest ? "Added " : "Updated ") << *tr;
 	if (!g_triggersRegistered && tr->period > UpdatePeriod::Once && !c->pauseDataUpdates)
@@ -1360,9 +2627,12 @@ std::string setSuspendClientDataUpdates(Client *c, bool suspend)
 
 	// Check for any "Once" type requests which are still pending and send them.
 	// While we're at it we can also check if there are any data updates which need scheduling.
+	// Any queued updates for this client were dropped by tick() while it was paused, so they need to be rescheduled.
 	bool resume = false;
+	const steady_clock::time_point now = steady_clock::now();
 	for (requestMap_t::value_type &rp : c->requests) {
 		if (rp.second.period >= UpdatePeriod::Tick) {
+			scheduleRequestUpdate(c, &rp.second, staggeredUpdateTime(&rp.second, now));
 			resume = true;
 		}
 		else if (rp.second.period == UpdatePeriod::Once && rp.second.interval == 1) {
@@ -1376,20 +2646,45 @@ std::string setSuspendClientDataUpdates(Client *c, bool suspend)
 	return "Data Subscription updates resumed";
 }
 
+bool setPackedDataUpdates(Client *c, bool enable, string *ackMsg)
+{
+	if (enable == c->packedDataUpdates)
+		return true;
+	if (!enable) {
+		flushPackedData(c);
+		c->packedDataUpdates = false;
+		*ackMsg = "Packed data updates disabled";
+		return true;
+	}
+	if (!c->cddID_packedData) {
+		// first time enabled, set up packed data CDA which the client should have already created
+		c->cddID_packedData = g_nextClienDataId++;
+		if (!registerClientPackedDataArea(c)) {
+			c->cddID_packedData = 0;
+			*ackMsg = "Failed to set up packed data area, check log messages.";
+			return false;
+		}
+	}
+	c->packedData.reserve(PACKED_DATA_AREA_SIZE);
+	c->packedDataUpdates = true;
+	*ackMsg = "Packed data updates enabled";
+	return true;
+}
+
 #pragma endregion  Data Requests
 
 #pragma region  Registered Calculator Events  ----------------------------------------------
 
 bool removeCustomEvent(Client *c, uint32_t eventId)
 {
-	if (c->events.count(eventId)) {
-		c->events.erase(eventId);
-	}
-	else {
+	const clientEventMap_t::iterator pos = c->events.find(eventId);
+	if (pos == c->events.end()) {
 		LOG_WRN << "Could not find event record for client " << c->name << " with event ID " << eventId;
 		return false;
 	}
-	removeClientCustomEvent(c, eventId);
+	removeClientCustomEvent(c, pos->second);
+	removeNameIndex(c->eventCodeIndex, pos->second.code, eventId);
+	c->events.erase(pos);
 	LOG_INF << "Deleted registered event ID " << eventId << " for Client " << c->name;
 	return true;
 }
@@ -1441,7 +2736,8 @@ void createOrUpdateCustomEvent(Client *c, const Command *const cmd)
 	if (newEvent) {
 		const SIMCONNECT_CLIENT_EVENT_ID clientEventId = g_nextClientEventId++;
 		if SUCCEEDED(SimConnectHelper::newClientEvent(g_hSimConnect, clientEventId, ev->name, c->clientId, (c->events.empty() ? SIMCONNECT_GROUP_PRIORITY_HIGHEST_MASKABLE : 0), true)) {
-			g_mEventIds.emplace(piecewise_construct, forward_as_tuple(clientEventId), forward_as_tuple(eventId, c));
+			g_mEventIds.set(clientEventId, EventIdRecord(eventId, c));
+			ev->clientEventId = clientEventId;
 		}
 		else {
 			logAndNak(c, *cmd, ostringstream() << "Failed to set up new SimConnect Client Event for calculator event name " << quoted(ev->name) << "; Check log messages for details.");
@@ -1457,20 +2753,19 @@ void createOrUpdateCustomEvent(Client *c, const Command *const cmd)
 	}
 
 	// (re)compile the code string
-	PCSTRINGZ pCompiled = nullptr;
-	UINT32 uCompiledSize = 0;
-	const bool ok = gauge_calculator_code_precompile(&pCompiled, &uCompiledSize, string(svCode).c_str());
-	if (ok && pCompiled && uCompiledSize > 0) {
-		c->events[eventId].execCode = string(pCompiled, uCompiledSize);
-		// DO NOT try to log the compiled "string" -- it's byte code now and may crash the logger
-		LOG_DBG << "Got compiled calculator string size " << uCompiledSize << ": " << Utilities::byteArrayToHex(pCompiled, uCompiledSize);
+	string bytecode;
+	if (compileCalculatorCode(svCode, bytecode)) {
+		ev->execCode = move(bytecode);
+		removeNameIndex(c->eventCodeIndex, ev->code, eventId);
+		ev->code = svCode;
+		c->eventCodeIndex.emplace(ev->code, eventId);
 	}
 	else {
-		logAndNak(c, *cmd, ostringstream()
-							<< "Calculator string compilation failed for event " << quoted(ev->name) << ". gauge_calculator_code_precompile() returned: " << boolalpha << ok
-							<< "; size: " << uCompiledSize << "; Result null? " << (pCompiled == nullptr) << "; Original code : " << quoted(svCode));
-		if (newEvent)
+		logAndNak(c, *cmd, ostringstream() << "Calculator string compilation failed for event " << quoted(ev->name) << "; Original code : " << quoted(svCode));
+		if (newEvent) {
+			removeClientCustomEvent(c, *ev);
 			c->events.erase(eventId);
+		}
 		return;
 	}
 
@@ -1499,72 +2794,411 @@ bool executeClientEvent(const Client *c, uint32_t eventId, string *ackMsg = null
 }
 #pragma endregion  Registered Events
 
-void sendKeyEvent(const Client *c, const Command *const cmd)
+// Adds (positive value) or removes (negative value) a key event ID to/from the client's list of events to coalesce, or clears the list (zero value).
+bool setKeyEventCoalescing(Client *c, double value, string *ackMsg)
+{
+	if (value == 0.0) {
+		c->coalescedKeyEventIds.clear();
+		return true;
+	}
+	const uint32_t keyId = (uint32_t)std::fabs(value);
+	if (keyId <= KEY_NULL) {
+		*ackMsg = "Invalid Key Event ID.";
+		return false;
+	}
+	const auto pos = std::find(c->coalescedKeyEventIds.cbegin(), c->coalescedKeyEventIds.cend(), keyId);
+	if (value > 0.0 && pos == c->coalescedKeyEventIds.cend())
+		c->coalescedKeyEventIds.push_back(keyId);
+	else if (value < 0.0 && pos != c->coalescedKeyEventIds.cend())
+		c->coalescedKeyEventIds.erase(pos);
+	return true;
+}
+
+// Triggers a key event right away, or buffers it until the next tick if it is coalescable, replacing any pending event with the same ID and extra values from the same client.
+void triggerKeyEvent(Client *c, const KeyEvent &kev)
+{
+	if (c->coalescedKeyEventIds.empty() || std::find(c->coalescedKeyEventIds.cbegin(), c->coalescedKeyEventIds.cend(), kev.eventId) == c->coalescedKeyEventIds.cend()) {
+		trigger_key_event_EX1(kev.eventId, kev.values[0], kev.values[1], kev.values[2], kev.values[3], kev.values[4]);
+		++c->stats.keyEventCount;
+		return;
+	}
+	// only a few axes are typically active at once, so a linear search is fine here
+	auto pos = std::find_if(c->coalescedKeyEvents.begin(), c->coalescedKeyEvents.end(), [&](const KeyEvent &e) {
+		return e.eventId == kev.eventId && !memcmp(&e.values[1], &kev.values[1], sizeof(kev.values) - sizeof(kev.values[0]));
+	});
+	if (pos != c->coalescedKeyEvents.end()) {
+		*pos = kev;
+		++c->stats.coalescedCount;
+		++g_coalescedKeyEvents;
+		return;
+	}
+	c->coalescedKeyEvents.push_back(kev);
+	if (!g_triggersRegistered)
+		resumeTriggerEvent();  // buffered events are triggered on the next tick
+}
+
+// Triggers all of the client's buffered coalescable key events, called once per tick.
+void flushCoalescedKeyEvents(Client *c)
+{
+	for (const KeyEvent &kev : c->coalescedKeyEvents)
+		trigger_key_event_EX1(kev.eventId, kev.values[0], kev.values[1], kev.values[2], kev.values[3], kev.values[4]);
+	c->stats.keyEventCount += c->coalescedKeyEvents.size();
+	c->coalescedKeyEvents.clear();
+}
+
+void sendKeyEvent(Client *c, const Command *const cmd)
 {
 	uint32_t keyId = cmd->uData;
 	if (!keyId && cmd->sData[0] > 0)
 		keyId = Utilities::getKeyEventId(cmd->sData);    // Intellicode erroneous error flag
 
 	if (keyId) {
-		trigger_key_event_EX1(keyId, (UINT32)cmd->fData);
+		triggerKeyEvent(c, KeyEvent(keyId, { (uint32_t)cmd->fData }, cmd->token));
 		sendAckNak(c, *cmd);
 		return;
 	}
 	sendAckNak(c, *cmd, false, "Named Key Event not found.");
 }
 
-void sendKeyEvent(const Client *c, const KeyEvent *const kev)
+void sendKeyEvent(Client *c, const KeyEvent *const kev)
 {
 	if (kev->eventId > KEY_NULL) {
-		trigger_key_event_EX1(kev->eventId, kev->values[0], kev->values[1], kev->values[2], kev->values[3], kev->values[4]);
+		triggerKeyEvent(c, *kev);
 		sendAckNak(c, CommandId::SendKey, true, kev->token);
 		return;
 	}
 	sendAckNak(c, CommandId::SendKey, false, kev->token, "Invalid Key Event ID.");
 }
 
+// Triggers all events in the client's key event queue area which were written since the last time it was read, and sends one Ack for all of them.
+void processKeyEventQueue(Client *c, const uint8_t *data, size_t dataSize)
+{
+	if (dataSize < KEY_EVENT_QUEUE_AREA_SIZE) {
+		LOG_CRT << "Invalid key event queue data size! Expected " << KEY_EVENT_QUEUE_AREA_SIZE << " but got " << dataSize;
+		return;
+	}
+	if (!c->keyEventQueue) {
+		LOG_WRN << "Ignoring key event queue data from client " << c->name << " which has not enabled the queue.";
+		return;
+	}
+	const uint32_t writeSeq = reinterpret_cast<const KeyEventQueueHeader *>(data)->writeSequence;
+	// the client restarts the sequence when it reconnects
+	if (writeSeq < c->keyEventReadSeq)
+		c->keyEventReadSeq = 0;
+	if (writeSeq == c->keyEventReadSeq)
+		return;  // nothing new, the events were already processed from a previous write
+	uint32_t pending = writeSeq - c->keyEventReadSeq;
+	const KeyEvent *const slots = reinterpret_cast<const KeyEvent *>(data + sizeof(KeyEventQueueHeader));
+	if (pending > KEY_EVENT_QUEUE_SIZE) {
+		// the overwritten events are gone, so report the overflow with the token of the oldest event which is still available
+		const uint32_t dropped = pending - KEY_EVENT_QUEUE_SIZE;
+		pending = KEY_EVENT_QUEUE_SIZE;
+		const KeyEvent &oldest = slots[(writeSeq - pending) % KEY_EVENT_QUEUE_SIZE];
+		LOG_WRN << "Key event queue overflow, " << dropped << " events from client " << c->name << " were dropped.";
+		sendAckNak(c, CommandId::SendKey, false, oldest.token, "Key event queue overflow, events preceding this one were dropped.", (double)dropped);
+	}
+	uint32_t lastToken = 0;
+	uint32_t count = 0;
+	for (uint32_t seq = writeSeq - pending + 1; seq != writeSeq + 1; ++seq) {
+		const KeyEvent &kev = slots[(seq - 1) % KEY_EVENT_QUEUE_SIZE];
+		if (kev.eventId > KEY_NULL) {
+			triggerKeyEvent(c, kev);
+			lastToken = kev.token;
+			++count;
+		}
+		else {
+			sendAckNak(c, CommandId::SendKey, false, kev.token, "Invalid Key Event ID.");
+		}
+	}
+	c->keyEventReadSeq = writeSeq;
+	LOG_TRC << "Processed " << count << " of " << pending << " queued key events for client " << c->name;
+	if (count)
+		sendAckNak(c, CommandId::SendKey, true, lastToken, nullptr, (double)count);
+}
+
 #pragma endregion Command Handlers
 
 //----------------------------------------------------------------------------
 #pragma region Core Processing
 //----------------------------------------------------------------------------
 
+// Returns true if a client has reached the per-tick limit of request updates or written data bytes.
+bool isClientThrottled(const Client *c)
+{
+	return (g_clientUpdatesPerTick && c->tickUpdates >= g_clientUpdatesPerTick) || (g_clientBytesPerTick && c->tickBytes >= g_clientBytesPerTick);
+}
+
+// Updates the request value for a scheduled update entry and schedules the next one. Returns false if the entry was stale.
+bool processScheduledUpdate(Client *c, const ScheduledUpdate &su, const steady_clock::time_point &now)
+{
+	TrackedRequest *r = findClientRequest(c, su.requestId);
+	if (!r || r->scheduleSeq != su.seq)
+		return false;
+	// how late the update is, relative to the start of this update cycle
+	if (now > su.due) {
+		const steady_clock::duration lag = now - su.due;
+		addTiming(r->stats.updateCount, r->stats.updateLagTotal, r->stats.updateLagMax, lag);
+		addTiming(c->stats.updateCount, c->stats.updateLagTotal, c->stats.updateLagMax, lag);
+		addTiming(g_priorityLag[su.priorityClass].count, g_priorityLag[su.priorityClass].total, g_priorityLag[su.priorityClass].max, lag);
+		if (lag > milliseconds(TICK_PERIOD_MS)) {
+			++r->stats.lateCount;
+			++c->stats.lateCount;
+		}
+	}
+	else {
+		++r->stats.updateCount;
+		++c->stats.updateCount;
+		++g_priorityLag[su.priorityClass].count;
+	}
+	// do the update and write the result
+	updateRequestValue(c, r, true, nullptr, true);
+	++c->tickUpdates;
+	// schedule next update (note that updateRequestValue() may change the update period to None, for example, for invalid requests)
+	scheduleRequestUpdate(c, r, nextRequestUpdateTime(r, su.due, now));
+	return true;
+}
+
+// Returns the index of the first due client with an ID greater than `afterClientId`, or zero if there is none. The clients must be sorted by ID.
+size_t roundRobinStart(const vector<Client *> &clients, uint32_t afterClientId)
+{
+	const vector<Client *>::const_iterator pos = std::upper_bound(clients.cbegin(), clients.cend(), afterClientId, [](uint32_t id, const Client *c) { return id < c->clientId; });
+	return pos == clients.cend() ? 0 : size_t(pos - clients.cbegin());
+}
+
+// Processes the due updates of one priority class for all clients, one update per client on each pass, starting with the first client after `afterClientId` in client ID order.
+// If `budgetEnd` is not null then processing stops at that time (but at least one update per frame is always processed), and the per-client limits apply.
+// Any updates which are not processed remain in the clients' due lists, and g_updateBacklog is set if processing was stopped by the time budget.
+void serviceDueUpdates(RequestPriority priority, const steady_clock::time_point &now, uint32_t afterClientId, const steady_clock::time_point *budgetEnd, bool &processedAny)
+{
+	const size_t p = priorityClass(priority);
+	const vector<Client *> &clients = g_dueClients[p];
+	const size_t clientCount = clients.size();
+	const size_t firstClient = roundRobinStart(clients, afterClientId);
+	size_t remaining = clientCount;  // number of clients with unprocessed updates
+	while (remaining) {
+		for (size_t i = 0; i < clientCount; ++i) {
+			Client *c = clients[(firstClient + i) % clientCount];
+			vector<ScheduledUpdate> &due = c->dueUpdates[p];
+			size_t &next = c->dueNext[p];
+			if (next >= due.size())
+				continue;
+			if (budgetEnd) {
+				// always do at least one update per frame so that processing can't stall completely
+				if (g_frameTimeBudget && processedAny && steady_clock::now() >= *budgetEnd) {
+					// remaining due updates are queued again by the caller and are processed first on the next frame
+					g_updateBacklog = true;
+					return;
+				}
+				if (isClientThrottled(c)) {
+					// the client's remaining due updates are queued again, keeping their due times, and processed first on the next tick
+					if (!c->throttled) {
+						c->throttled = true;
+						++c->stats.throttledCount;
+						++g_throttledClientTicks;
+					}
+					for (; next < due.size(); ++next)
+						g_updateSchedule.push(due[next]);
+					--remaining;
+					continue;
+				}
+			}
+			const ScheduledUpdate &su = due[next++];
+			if (next == due.size())
+				--remaining;
+			if (processScheduledUpdate(c, su, now))
+				processedAny = true;
+		}
+	}
+}
+
+// Queues streamed L var values from a client's setter stream area to be applied on the next frame, replacing any pending value for the same variable.
+void queueStreamedSetters(const Client *c, const uint8_t *data, size_t dataSize)
+{
+	if (dataSize < sizeof(SetterStreamHeader)) {
+		LOG_CRT << "Invalid setter stream data size! Expected at least " << sizeof(SetterStreamHeader) << " but got " << dataSize;
+		return;
+	}
+	const SetterStreamHeader *const hdr = reinterpret_cast<const SetterStreamHeader *const>(data);
+	if (hdr->recordCount > (dataSize - sizeof(SetterStreamHeader)) / sizeof(SetterStreamRecord)) {
+		LOG_ERR << "Invalid setter stream block from client " << c->name << ", record count " << hdr->recordCount << " exceeds block size.";
+		return;
+	}
+	const SetterStreamRecord *rec = reinterpret_cast<const SetterStreamRecord *>(data + sizeof(SetterStreamHeader));
+	for (const SetterStreamRecord *const end = rec + hdr->recordCount; rec != end; ++rec) {
+		if (rec->variableId < 0) {
+			LOG_WRN << "Invalid variable ID " << rec->variableId << " in setter stream from client " << c->name;
+			continue;
+		}
+		++g_streamedSetters;
+		// only a few variables are typically streamed at once, so a linear search beats hashing here
+		auto pos = std::find_if(g_pendingSetters.begin(), g_pendingSetters.end(), [&](const SetterStreamRecord &r) { return r.variableId == rec->variableId; });
+		if (pos != g_pendingSetters.end())
+			*pos = *rec;
+		else
+			g_pendingSetters.push_back(*rec);
+	}
+	if (!g_triggersRegistered && !g_pendingSetters.empty()) {
+		resumeTriggerEvent();  // values are applied on the next frame
+		g_settersResumedTrigger = g_triggersRegistered;
+	}
+}
+
+// Sets all pending streamed L var values, called on every frame.
+void applyStreamedSetters()
+{
+	for (const SetterStreamRecord &rec : g_pendingSetters) {
+		if (rec.unitId > -1)
+			set_named_variable_typed_value(rec.variableId, rec.value, rec.unitId);
+		else
+			set_named_variable_value(rec.variableId, rec.value);
+	}
+	g_appliedSetters += g_pendingSetters.size();
+	g_pendingSetters.clear();
+}
+
 void tick()
 {
+	// streamed values are applied on every frame, not just on each tick
+	if (!g_pendingSetters.empty()) {
+		applyStreamedSetters();
+	}
+	else if (g_settersResumedTrigger) {
+		// a whole frame passed without new values, so check if the frame event is still needed for anything else
+		g_settersResumedTrigger = false;
+		checkTriggerEventNeeded();
+	}
+
 	const steady_clock::time_point now = steady_clock::now();
-	if (g_tpNextTick > now)
+	// Between ticks we only continue processing any updates which were deferred from the previous frame due to the time budget.
+	if (g_tpNextTick > now && !g_updateBacklog)
 		return;
-	g_tpNextTick = now + milliseconds(TICK_PERIOD_MS);
 
-	for (clientMap_t::value_type &cp : g_mClients) {
-		Client &c = cp.second;
-		if (c.status != ClientStatus::Connected || c.pauseDataUpdates)
-			continue;
-		// check for timeout
-		if (now >= c.nextTimeout) {
-			disconnectClient(&c, "Client connection timed out.", ClientStatus::TimedOut);
+	if (g_tpNextTick <= now) {
+		g_tpNextTick = now + milliseconds(TICK_PERIOD_MS);
+
+		bool flushedKeyEvents = false;
+		for (clientMap_t::value_type &cp : g_mClients) {
+			Client &c = cp.second;
+			// reset per-tick update limits
+			c.tickUpdates = c.tickBytes = 0;
+			c.throttled = false;
+			// trigger the latest values of any coalesced key events, also regardless of data updates being paused
+			if (!c.coalescedKeyEvents.empty() && c.status == ClientStatus::Connected) {
+				flushCoalescedKeyEvents(&c);
+				flushedKeyEvents = true;
+			}
+			// continue any List results in progress, regardless of data updates being paused
+			if (c.listCursor.active && c.status == ClientStatus::Connected && continueLocalVarsList(&c))
+				finishList(&c);
+			if (c.status != ClientStatus::Connected || c.pauseDataUpdates)
+				continue;
+			// check for timeout
+			if (now >= c.nextTimeout) {
+				disconnectClient(&c, "Client connection timed out.", ClientStatus::TimedOut);
+				continue;
+			}
+			// check for heartbeat timeout and ping the client if needed
+			if (now >= c.nextHearbeat) {
+				c.nextHearbeat = now + seconds(CONN_HEARTBEAT_SEC);
+				sendPing(&c);
+			}
+		}
+		// the trigger event may only have been resumed for the coalesced key events
+		if (flushedKeyEvents)
+			checkTriggerEventNeeded();
+	}
+
+	// Collect the updates which are due for each client and priority class, in order of their scheduled update time. Each class is then processed
+	// round-robin between clients, starting with the next client in ID order on each tick, so that a client with many requests cannot starve the others
+	// when the frame time budget or the per-client limits run out.
+	while (!g_updateSchedule.empty() && g_updateSchedule.top().due <= now) {
+		const ScheduledUpdate su = g_updateSchedule.top();
+		g_updateSchedule.pop();
+		// Skip stale entries. Requests of paused clients are dropped here and get rescheduled when updates are resumed.
+		Client *c = findClient(su.clientId);
+		if (!c || c->status != ClientStatus::Connected || c->pauseDataUpdates)
 			continue;
+		if (c->dueUpdates[su.priorityClass].empty())
+			g_dueClients[su.priorityClass].push_back(c);
+		c->dueUpdates[su.priorityClass].push_back(su);
+	}
+	// the clients are collected in the order their updates come due, which can change on every tick
+	for (vector<Client *> &clients : g_dueClients)
+		std::sort(clients.begin(), clients.end(), [](const Client *a, const Client *b) { return a->clientId < b->clientId; });
+
+	// High priority updates are always processed. Normal priority updates may use their share of the time budget, and Background priority ones
+	// get any time which is left, or the reserved share if Normal priority updates didn't finish in theirs.
+	const uint32_t afterClientId = g_roundRobinClientId;
+	for (const vector<Client *> &clients : g_dueClients) {
+		if (!clients.empty()) {
+			g_roundRobinClientId = clients[roundRobinStart(clients, afterClientId)]->clientId;
+			break;
 		}
-		// check for heartbeat timeout and ping the client if needed
-		if (now >= c.nextHearbeat) {
-			c.nextHearbeat = now + seconds(CONN_HEARTBEAT_SEC);
-			sendPing(&c);
+	}
+	const steady_clock::time_point budgetEnd = now + microseconds(g_frameTimeBudget);
+	const steady_clock::time_point normalBudgetEnd = now + microseconds(uint64_t(g_frameTimeBudget) * std::min(g_normalPriorityBudget, 100U) / 100);
+	bool processedAny = false;
+	g_updateBacklog = false;
+	serviceDueUpdates(RequestPriority::High, now, afterClientId, nullptr, processedAny);
+	serviceDueUpdates(RequestPriority::Normal, now, afterClientId, &normalBudgetEnd, processedAny);
+	serviceDueUpdates(RequestPriority::Background, now, afterClientId, &budgetEnd, processedAny);
+	if (g_updateBacklog)
+		++g_deferredFrames;
+
+	// put back any updates which were not processed, keeping their original due times, and reset the per-client lists for the next tick
+	for (size_t p = 0; p < REQUEST_PRIORITY_CLASSES; ++p) {
+		for (Client *c : g_dueClients[p]) {
+			for (size_t i = c->dueNext[p]; i < c->dueUpdates[p].size(); ++i)
+				g_updateSchedule.push(c->dueUpdates[p][i]);
+			c->dueUpdates[p].clear();
+			c->dueNext[p] = 0;
 		}
-		// process data requests
-		for (requestMap_t::value_type &rp : c.requests) {
-			TrackedRequest &r = rp.second;
-			// check if update needed
-			if (r.period < UpdatePeriod::Tick || (r.interval > 0 && r.nextUpdate > now))
-				continue;
-			// do the update and write the result
-			updateRequestValue(&c, &r);
-			// schedule next update (note that updateRequestValue() may change the update period to None, for example, for invalid requests)
-			if (r.period == UpdatePeriod::Millisecond)
-				r.nextUpdate = now + milliseconds(r.interval);
-			else if (r.period == UpdatePeriod::Tick && r.interval > 0)
-				r.nextUpdate = now + milliseconds((r.interval + 1) * TICK_PERIOD_MS);
+		g_dueClients[p].clear();
+	}
+
+	// cached results are only valid for this tick, and the keys refer to request data which may change before the next one
+	g_evalCache.clear();
+
+	// send any pending packed data updates
+	for (clientMap_t::value_type &cp : g_mClients) {
+		if (cp.second.packedDataUpdates)
+			flushPackedData(&cp.second);
+	}
+}
+
+// Sends statistics records for each connected client and all their data requests, optionally resetting the counters.
+void sendStats(Client *c, const Command *const cmd)
+{
+	LOG_DBG << "Got Stats request for client " << c->name;
+	const bool allClients = cmd->fData != 0.0;
+	Command resp(CommandId::Stats);
+	resp.token = cmd->token;
+	auto sendClientRecords = [&](Client &sc) {
+		static_assert(sizeof(StatsRecord) <= STRSZ_CMD, "StatsRecord does not fit into Command::sData");
+		// only the requesting client's own counters can be reset
+		const bool reset = cmd->uData != 0 && &sc == c;
+		auto sendRecord = [&](StatsRecord &stats) {
+			memcpy(resp.sData, &stats, sizeof(StatsRecord));
+			sendResponse(c, resp);
+			if (reset)
+				stats = StatsRecord { stats.clientId, stats.requestId };
+		};
+		sendRecord(sc.stats);
+		for (requestMap_t::value_type &rp : sc.requests) {
+			rp.second.stats.clientId = sc.clientId;
+			sendRecord(rp.second.stats);
+		}
+	};
+	if (!allClients) {
+		sendClientRecords(*c);
+	}
+	else {
+		for (clientMap_t::value_type &cp : g_mClients) {
+			if (cp.second.status == ClientStatus::Connected)
+				sendClientRecords(cp.second);
 		}
 	}
+	sendAckNak(c, CommandId::Stats, true, cmd->token, "Stats results completed");
 }
 
 void processCommand(Client *c, const Command *const cmd)
@@ -1619,10 +3253,23 @@ void processCommand(Client *c, const Command *const cmd)
 			ack = setLogLevel(c, cmd, &ackMsg);
 			break;
 
+		case CommandId::Option:
+			ack = setClientOption(c, cmd, &ackMsg);
+			break;
+
+		case CommandId::Stats:
+			sendStats(c, cmd);
+			return;
+
 		case CommandId::Disconnect:
 			disconnectClient(c);
 			return;
 
+		case CommandId::Batch:
+			ack = false;
+			ackMsg = "Command batches must be written to the command batch data area.";
+			break;
+
 		case CommandId::Ping:      // just ACK the ping
 		case CommandId::Connect:   // client was already re-connected or we wouldn't be here, just ACK
 			break;
@@ -1641,7 +3288,92 @@ void processCommand(Client *c, const Command *const cmd)
 	sendAckNak(c, *cmd, ack, ackMsg.c_str());
 }
 
-void CALLBACK dispatchMessage(SIMCONNECT_RECV* pData, DWORD cbData, void*)
+// Processes the command and updates the client's statistics counters.
+void processCommandTimed(Client *c, const Command *const cmd)
+{
+	if (!g_collectTimingStats) {
+		++c->stats.commandCount;
+		processCommand(c, cmd);
+		return;
+	}
+	const steady_clock::time_point start = steady_clock::now();
+	processCommand(c, cmd);
+	addTiming(c->stats.commandCount, c->stats.commandTimeTotal, c->stats.commandTimeMax, steady_clock::now() - start);
+}
+
+// Sets up the client's batch results data area, if not done already.
+bool setupClientBatchResultsDataArea(Client *c)
+{
+	if (c->cddID_batchResults)
+		return true;
+	// Batch results area is named "WASimCommander.BatchResults.<client_name>"; read-only for client, which should have already created it
+	c->cddID_batchResults = g_nextClienDataId++;
+	const string cdaName(CDA_NAME_BATCHRES_PFX + c->name);
+	if FAILED(SimConnectHelper::registerDataArea(g_hSimConnect, cdaName, c->cddID_batchResults, c->cddID_batchResults, COMMAND_BATCH_AREA_SIZE, false)) {
+		c->cddID_batchResults = 0;
+		return false;
+	}
+	LOG_DBG << "Created CDA ID " << c->cddID_batchResults << " named " << quoted(cdaName) << " of size " << COMMAND_BATCH_AREA_SIZE;
+	return true;
+}
+
+// Runs all the commands of a batch in order and writes their responses to the client's batch results area, followed by an Ack. See CommandBatchHeader for data format.
+void processCommandBatch(Client *c, const uint8_t *data, size_t dataSize)
+{
+	if (dataSize < sizeof(CommandBatchHeader)) {
+		LOG_CRT << "Invalid command batch data size! Expected at least " << sizeof(CommandBatchHeader) << " but got " << dataSize;
+		return;
+	}
+	CommandBatchHeader hdr;
+	memcpy(&hdr, data, sizeof(CommandBatchHeader));
+	if (hdr.dataSize > dataSize - sizeof(CommandBatchHeader)) {
+		logAndNak(c, CommandId::Batch, hdr.token, ostringstream() << "Invalid command batch size " << hdr.dataSize << " exceeds available " << dataSize - sizeof(CommandBatchHeader));
+		return;
+	}
+	// every record takes at least a record header, so a larger count cannot be valid (and must not be allocated)
+	if (hdr.recordCount > hdr.dataSize / sizeof(CommandBatchRecord)) {
+		logAndNak(c, CommandId::Batch, hdr.token, ostringstream() << "Invalid command batch, record count " << hdr.recordCount << " exceeds batch size " << hdr.dataSize);
+		return;
+	}
+	// decode everything first so that a malformed batch is rejected without running any of it
+	vector<Command> commands(hdr.recordCount);
+	const uint8_t *pos = data + sizeof(CommandBatchHeader);
+	const uint8_t *const end = pos + hdr.dataSize;
+	for (Command &cmd : commands) {
+		if (!readCommandBatchRecord(pos, end, cmd)) {
+			logAndNak(c, CommandId::Batch, hdr.token, ostringstream() << "Invalid command batch, record " << (&cmd - commands.data()) << " exceeds batch size.");
+			return;
+		}
+	}
+	if (!setupClientBatchResultsDataArea(c)) {
+		logAndNak(c, CommandId::Batch, hdr.token, ostringstream() << "Could not set up the batch results data area for Client " << c->name);
+		return;
+	}
+	LOG_DBG << "Processing command batch " << hdr.token << " with " << hdr.recordCount << " commands";
+
+	g_commandBatch.client = c;
+	g_commandBatch.token = hdr.token;
+	g_commandBatch.block.clear();
+	for (const Command &cmd : commands) {
+		switch (cmd.commandId) {
+			case CommandId::List:
+			case CommandId::Disconnect:
+				sendAckNak(c, cmd, false, "Command cannot be batched.");
+				break;
+			default:
+				processCommandTimed(c, &cmd);
+				break;
+		}
+		if (c->status != ClientStatus::Connected)
+			break;
+	}
+	flushBatchResults();
+	g_commandBatch.client = nullptr;
+	g_commandBatch.block.clear();
+	sendAckNak(c, CommandId::Batch, true, hdr.token, "Batch results completed");
+}
+
+void processMessage(SIMCONNECT_RECV* pData)
 {
 	switch (pData->dwID)
 	{
@@ -1649,6 +3381,14 @@ void CALLBACK dispatchMessage(SIMCONNECT_RECV* pData, DWORD cbData, void*)
 			tick();
 			break;
 
+		case SIMCONNECT_RECV_ID_EVENT_FILENAME:
+			// Variable IDs may change with a new aircraft, and some may no longer exist.
+			if (((SIMCONNECT_RECV_EVENT *)pData)->uEventID == EVENT_AIRCRAFT_LOADED) {
+				LOG_DBG << "Aircraft loaded: " << quoted(((SIMCONNECT_RECV_EVENT_FILENAME *)pData)->szFileName);
+				clearNameIdCaches();
+			}
+			break;
+
 		case SIMCONNECT_RECV_ID_EVENT:
 		case SIMCONNECT_RECV_ID_EVENT_EX1:
 		{
@@ -1703,7 +3443,7 @@ void CALLBACK dispatchMessage(SIMCONNECT_RECV* pData, DWORD cbData, void*)
 						LOG_CRT << "Invalid Command struct data size! Expected " << sizeof(Command) << " but got " << dataSize;
 						return;
 					}
-					processCommand(c, reinterpret_cast<const Command *const>(&data->dwData));
+					processCommandTimed(c, reinterpret_cast<const Command *const>(&data->dwData));
 					break;
 
 				case RecordType::KeyEventData:
@@ -1724,10 +3464,25 @@ void CALLBACK dispatchMessage(SIMCONNECT_RECV* pData, DWORD cbData, void*)
 					addOrUpdateRequest(c, reinterpret_cast<const DataRequest *const>(&data->dwData));
 					break;
 
+				case RecordType::CommandBatchData:
+					processCommandBatch(c, reinterpret_cast<const uint8_t *>(&data->dwData), dataSize);
+					break;
+
+				case RecordType::KeyEventQueueData:
+					processKeyEventQueue(c, reinterpret_cast<const uint8_t *>(&data->dwData), dataSize);
+					break;
+
+				case RecordType::SetterStreamData:
+					queueStreamedSetters(c, reinterpret_cast<const uint8_t *>(&data->dwData), dataSize);
+					break;
+
 				default:
 					LOG_ERR << "Unrecognized data record type: " << (int)dr->type << " in: " << LOG_SC_RCV_CLIENT_DATA(data);
 					return;
 			}
+			// send any value updates resulting from the command/request right away
+			if (c->packedDataUpdates)
+				flushPackedData(c);
 			break;
 		}  // SIMCONNECT_RECV_ID_CLIENT_DATA
 
@@ -1750,6 +3505,14 @@ void CALLBACK dispatchMessage(SIMCONNECT_RECV* pData, DWORD cbData, void*)
 	}
 }
 
+void CALLBACK dispatchMessage(SIMCONNECT_RECV* pData, DWORD cbData, void*)
+{
+	processMessage(pData);
+	// send any client log records resulting from the message (which includes a whole tick of processing)
+	if (g_clientLogsPending)
+		flushClientLogs();
+}
+
 extern "C" {
 
 MSFS_CALLBACK void module_init(void)
@@ -1773,8 +3536,21 @@ MSFS_CALLBACK void module_init(void)
 		const auto &logSect = ini.sections["logging"];               // Intellicode erroneous errors next several lines
 		inipp::get_value(logSect, "consoleLogLevel", consoleLevel);
 		inipp::get_value(logSect, "fileLogLevel", fileLevel);
+		inipp::get_value(logSect, "clientLogQueueSize", g_logQueueSize);
 		const auto &netSect = ini.sections["network"];
 		inipp::get_value(netSect, "requestTrackingMaxRecords", requestTrackingMaxRecords);
+		const auto &procSect = ini.sections["processing"];
+		inipp::get_value(procSect, "requestEvaluationCache", g_evalCacheEnabled);
+		inipp::get_value(procSect, "frameTimeBudget", g_frameTimeBudget);
+		inipp::get_value(procSect, "staggerRequestUpdates", g_staggerUpdates);
+		inipp::get_value(procSect, "collectTimingStats", g_collectTimingStats);
+		inipp::get_value(procSect, "compiledCodeCacheSize", g_compiledCodeCacheSize);
+		inipp::get_value(procSect, "execCompileRepeats", g_execCompileRepeats);
+		inipp::get_value(procSect, "nameLookupCache", g_nameIdCacheEnabled);
+		inipp::get_value(procSect, "listItemsPerTick", g_listItemsPerTick);
+		inipp::get_value(procSect, "clientUpdatesPerTick", g_clientUpdatesPerTick);
+		inipp::get_value(procSect, "clientBytesPerTick", g_clientBytesPerTick);
+		inipp::get_value(procSect, "normalPriorityBudget", g_normalPriorityBudget);
 		int idx;
 		if ((idx = Utilities::indexOfString(LogLevelNames, fileLevel.c_str())) > -1)
 			fileLogLevel = LogLevel(idx);
@@ -1814,6 +3590,9 @@ MSFS_CALLBACK void module_init(void)
 		return;
 	}
 	pauseTriggerEvent();  // pause frame updates for now
+	// watch for aircraft changes to invalidate cached variable IDs
+	if (g_nameIdCacheEnabled)
+		INVOKE_SIMCONNECT(SubscribeToSystemEvent, g_hSimConnect, (SIMCONNECT_CLIENT_EVENT_ID)EVENT_AIRCRAFT_LOADED, "AircraftLoaded");
 
 	// Go
 	if FAILED(hr = SimConnect_CallDispatch(g_hSimConnect, dispatchMessage, nullptr)) {
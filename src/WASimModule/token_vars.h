@@ -18,17 +18,14 @@ and is also available at <http://www.gnu.org/licenses/>.
 */
 
 #pragma once
-#include <map>
+#include <string_view>
 #include <MSFS/Legacy/gauges.h>
+#include "utilities.h"
 
 namespace WASimCommander {
 	namespace Utilities {
 
-	// returns MODULE_VAR_NONE (0) if the name wasn't found
-	static GAUGE_TOKEN getTokenVariableId(const std::string &name)
-	{
-		using nameToIdMap_t = std::map<std::string, GAUGE_TOKEN>;
-		static const nameToIdMap_t namesMap = {
+	static constexpr NameIdPair<GAUGE_TOKEN> TOKEN_VARIABLE_NAMES[] = {
 	{ "MODULE_VAR_NONE", MODULE_VAR_NONE },
 	{ "TICK18", TICK18},
 	{ "GROUND_ALTITUDE", GROUND_ALTITUDE },
@@ -1316,8 +1313,20 @@ namespace WASimCommander {
 	{ "BREAKER_NAVCOM4", BREAKER_NAVCOM4 },
 };
 
-		const nameToIdMap_t::const_iterator el = namesMap.find(name);
-		return el == namesMap.cend() ? MODULE_VAR_NONE : el->second;
+	static constexpr ConstNameTable TOKEN_VARIABLE_NAMES_TABLE(TOKEN_VARIABLE_NAMES);
+
+	// returns MODULE_VAR_NONE (0) if the name wasn't found
+	static constexpr GAUGE_TOKEN getTokenVariableId(std::string_view name)
+	{
+		const NameIdPair<GAUGE_TOKEN> *el = TOKEN_VARIABLE_NAMES_TABLE.findName(name);
+		return el ? el->id : MODULE_VAR_NONE;
+	}
+
+	// returns an empty string if the ID wasn't found
+	static constexpr std::string_view getTokenVariableName(GAUGE_TOKEN id)
+	{
+		const NameIdPair<GAUGE_TOKEN> *el = TOKEN_VARIABLE_NAMES_TABLE.findId(id);
+		return el ? el->name : std::string_view();
 	}
 
 };};
@@ -42,6 +42,13 @@ and are available at <http://www.gnu.org/licenses/>.
 #define WSMCMND_CDA_NAME_DATA       "Data"       ///< Data area name prefix for `DataRequest` data sent to Server ("WASimCommander.Data.<client_name>") and data value updates sent to Client: "WASimCommander.Data.<client_name>.<request_id>"
 #define WSMCMND_CDA_NAME_KEYEVENT   "KeyEvent"   ///< Data area name prefix for `KeyEvent` data sent to Client: "WASimCommander.KeyEvent.<client_name>"  \since v1.1.0
 #define WSMCMND_CDA_NAME_LOG        "Log"        ///< Data area name prefix for `LogRecord` data sent to Client: "WASimCommander.Log.<client_name>"
+#define WSMCMND_CDA_NAME_PACKED     "PackedData" ///< Data area name prefix for packed data value updates sent to Client: "WASimCommander.PackedData.<client_name>"  \since v1.4.0
+#define WSMCMND_CDA_NAME_LIST       "ListData"   ///< Data area name prefix for packed `List` command results sent to Client: "WASimCommander.ListData.<client_name>"  \since v1.4.0
+#define WSMCMND_CDA_NAME_LOGDATA    "LogData"    ///< Data area name prefix for packed log record batches sent to Client: "WASimCommander.LogData.<client_name>"  \since v1.4.0
+#define WSMCMND_CDA_NAME_CMDBATCH   "CommandBatch"  ///< Data area name prefix for batches of `Command` data sent to Server: "WASimCommander.CommandBatch.<client_name>"  \since v1.4.0
+#define WSMCMND_CDA_NAME_BATCHRES   "BatchResults"  ///< Data area name prefix for packed command batch responses sent to Client: "WASimCommander.BatchResults.<client_name>"  \since v1.4.0
+#define WSMCMND_CDA_NAME_KEYQUEUE   "KeyEventQueue" ///< Data area name prefix for queued `KeyEvent` data sent to Server: "WASimCommander.KeyEventQueue.<client_name>"  \since v1.4.0
+#define WSMCMND_CDA_NAME_SETTER     "SetterStream"  ///< Data area name prefix for streamed local variable values sent to Server: "WASimCommander.SetterStream.<client_name>"  \since v1.4.0
 
 /// WASimCommander main namespace. Defines constants and structs used in Client-Server interactions. Many of these are needed for effective use of `WASimClient`,
 /// and all would be useful for custom client implementations.
@@ -54,7 +61,7 @@ namespace WASimCommander
 	/// \name Char array string size limits, including null terminator.
 	/// \{
 	static const size_t STRSZ_CMD   = 527;   ///< Maximum size of \refwc{Command::sData} member. Size optimizes alignment of `Command` struct.
-	static const size_t STRSZ_REQ   = 1030;  ///< Maximum size for request calculator string or variable name. Size optimizes alignment of `DataRequest` struct. \sa \refwc{DataRequest::nameOrCode}
+	static const size_t STRSZ_REQ   = 1024;  ///< Maximum size for request calculator string or variable name. Size optimizes alignment of `DataRequest` struct. \sa \refwc{DataRequest::nameOrCode}
 	static const size_t STRSZ_UNIT  = 37;    ///< Maximum Unit name size. Size is of longest known unit name + 1. \sa \refwc{DataRequest::unitName}
 	static const size_t STRSZ_LOG   = 1031;  ///< Size of log entry message in \refwc{LogRecord::message}. Size optimizes alignment of `LogRecord` struct.
 	static const size_t STRSZ_ENAME = 64;    ///< Maximum size of custom event name in \refwce{CommandId::Register} command.
@@ -66,6 +73,18 @@ namespace WASimCommander
 	static const time_t CONN_TIMEOUT_SEC = 60 * 10;  ///< Number of seconds after which a non-responsive client is considered disconnected. Client must respond to heartbeat pings from the server if not otherwise transmitting anything within this timeout period.
 	/// \}
 
+	/// \name Data area sizes
+	/// \{
+	static const uint32_t PACKED_DATA_AREA_SIZE = 8192;  ///< Size of the data area used for packed data value updates, in bytes (this is also the maximum size of a SimConnect client data area). \sa PackedDataHeader  \since v1.4.0
+	static const uint32_t LIST_DATA_AREA_SIZE   = 8192;  ///< Size of the data area used for packed `List` command results, in bytes. \sa ListDataHeader  \since v1.4.0
+	static const uint32_t LOG_DATA_AREA_SIZE    = 8192;  ///< Size of the data area used for packed log record batches, in bytes. \sa LogDataHeader  \since v1.4.0
+	static const uint32_t COMMAND_BATCH_AREA_SIZE = 8192;  ///< Size of the data areas used for command batches and their results, in bytes. \sa CommandBatchHeader  \since v1.4.0
+	static const uint32_t KEY_EVENT_QUEUE_SIZE      = 16;   ///< Number of `KeyEvent` slots in the "key event queue" data area. \sa KeyEventQueueHeader  \since v1.4.0
+	static const uint32_t KEY_EVENT_QUEUE_AREA_SIZE = 520;  ///< Size of the "key event queue" data area, in bytes: an 8 B `KeyEventQueueHeader` followed by \refwc{KEY_EVENT_QUEUE_SIZE} 32 B `KeyEvent` slots. \since v1.4.0
+	static const uint32_t SETTER_STREAM_MAX_RECORDS = 16;  ///< Maximum number of `SetterStreamRecord`s in one write to the "setter stream" data area. \sa SetterStreamHeader  \since v1.4.0
+	static const uint32_t SETTER_STREAM_AREA_SIZE   = 264;  ///< Size of the "setter stream" data area, in bytes: an 8 B `SetterStreamHeader` followed by room for \refwc{SETTER_STREAM_MAX_RECORDS} 16 B `SetterStreamRecord`s. \sa SetterStreamHeader  \since v1.4.0
+	/// \}
+
 	/// \name Predefined value types
 	/// Using these constants for the \refwc{DataRequest::valueSize} property will allow delta epsilon comparisons.
 	/// \{
@@ -136,11 +155,21 @@ namespace WASimCommander
 		uint32_t interval;                   ///< How many `UpdatePeriod` period's should elapse between checks. eg. 500ms or 10 ticks.
 		                                     ///  Zero means to check at every `period`, `1` means every other `period`, etc.
 		WSE::UpdatePeriod period;            ///< How often to read/calculate this value.
-		WSE::RequestType requestType;        ///< Named variable or calculated value.
+		WSE::RequestType requestType;        ///< Named variable, calculated value, or group of other requests.
 		WSE::CalcResultType calcResultType;  ///< Expected calculator result type.
 		uint8_t simVarIndex;                 ///< Some SimVars require an index for access, default is 0.
 		char varTypePrefix;                  ///< Variable type prefix for named variables. Types: 'L' (local), 'A' (SimVar) and 'T' (Token, not an actual GaugeAPI prefix) are checked using respective GaugeAPI methods.
 		char nameOrCode[STRSZ_REQ] = {0};    ///< Variable name or full calculator string.
+		// Members added in v1.4.0 occupy what used to be the last bytes of `nameOrCode`, so the offsets of all the older members are unchanged
+		// and a zero value is the default for each. Older clients set them to zero unless the name/code was longer than `STRSZ_REQ - 1`, which the server rejects.
+		uint16_t minUpdateInterval = 0;      ///< Minimum time, in milliseconds, between value updates sent for this request. A changed value is sent right away if the last update was sent longer ago than this,
+		                                     ///  otherwise the change is held back and the latest value is sent when the interval ends. Only applies to requests with a recurring `period`. `0` (default) disables. \since v1.4.0
+		uint16_t maxUpdateInterval = 0;      ///< Maximum time, in milliseconds, between value updates sent for this request ("keep-alive"); the current value is sent again after this time even if it did not change.
+		                                     ///  Overrides the Client's `ClientOption::UpdateHeartbeat` setting for this request. Only applies to requests with a recurring `period`. `0` (default) disables. \since v1.4.0
+		WSE::RequestPriority priority = WSE::RequestPriority::Normal;  ///< Update priority class of this request, for when the server is busy. Default is `RequestPriority::Normal`. \since v1.4.0
+		uint8_t simVarIndexCount = 0;        ///< For named SimVar ('A') requests, when greater than `1` this requests the values of `simVarIndexCount` consecutive indexes, starting at `simVarIndex`, as one packed array.
+		                                     ///  `valueSize` then specifies the type (or size) of each array element, which must be a numeric type, and the total value size is the element size times `simVarIndexCount`.
+		                                     ///  A positive `deltaEpsilon` is compared against the largest change of any element. Default is 0 (a single value). \since v1.4.0
 		char unitName[STRSZ_UNIT] = {0};     ///< Unit name for named variables (optional to override variable's default units). Only 'L' and 'A' variable types support unit specifiers.
 		                                     //  1088/1088 B (packed/unpacked), 8/16 B aligned
 
@@ -156,10 +185,15 @@ namespace WASimCommander
 			char                varTypePrefix = 'L',
 			float               deltaEpsilon = 0.0f,
 			uint8_t             interval = 0,
-			uint8_t             simVarIndex = 0
+			uint8_t             simVarIndex = 0,
+			uint8_t             simVarIndexCount = 0,
+			uint16_t            minUpdateInterval = 0,
+			uint16_t            maxUpdateInterval = 0,
+			WSE::RequestPriority priority = WSE::RequestPriority::Normal
 		) :
 			requestId(requestId), valueSize(valueSize), deltaEpsilon(deltaEpsilon), interval(interval), period(period),
-			requestType(requestType), calcResultType(calcResultType), simVarIndex(simVarIndex), varTypePrefix(varTypePrefix)
+			requestType(requestType), calcResultType(calcResultType), simVarIndex(simVarIndex), varTypePrefix(varTypePrefix),
+			minUpdateInterval(minUpdateInterval), maxUpdateInterval(maxUpdateInterval), priority(priority), simVarIndexCount(simVarIndexCount)
 		{
 			if (nameOrCode)
 				setNameOrCode(nameOrCode);
@@ -202,10 +236,20 @@ namespace WASimCommander
 		{
 			const char *perName = (size_t)r.period < WSE::UpdatePeriodNames.size() ? WSE::UpdatePeriodNames.at((size_t)r.period) : "Invalid";
 			os << "DataRequest{" << r.requestId << "; size: " << r.valueSize << "; period: " << perName << "; interval: " << r.interval << "; deltaE: " << r.deltaEpsilon;
+			if (r.minUpdateInterval || r.maxUpdateInterval)
+				os << "; minInterval: " << r.minUpdateInterval << "; maxInterval: " << r.maxUpdateInterval;
+			if (r.priority != WSE::RequestPriority::Normal)
+				os << "; priority: " << ((size_t)r.priority < WSE::RequestPriorityNames.size() ? WSE::RequestPriorityNames.at((size_t)r.priority) : "Invalid");
 			if (r.requestType == WSE::RequestType::None)
 				return os << "; type: None; }";
-			if (r.requestType == WSE::RequestType::Named)
-				return os << "; type: Named; name: " << std::quoted(r.nameOrCode) << "; unit: " << std::quoted(r.unitName) << "; varType: '" << r.varTypePrefix << "'; varIndex: " << r.simVarIndex << '}';
+			if (r.requestType == WSE::RequestType::Named) {
+				os << "; type: Named; name: " << std::quoted(r.nameOrCode) << "; unit: " << std::quoted(r.unitName) << "; varType: '" << r.varTypePrefix << "'; varIndex: " << (uint16_t)r.simVarIndex;
+				if (r.simVarIndexCount > 1)
+					os << "; varIndexCount: " << (uint16_t)r.simVarIndexCount;
+				return os << '}';
+			}
+			if (r.requestType == WSE::RequestType::Group)
+				return os << "; type: Group; members: " << std::quoted(r.nameOrCode) << '}';
 			const char *typeName = (size_t)r.calcResultType < WSE::CalcResultTypeNames.size() ? WSE::CalcResultTypeNames.at((size_t)r.calcResultType) : "Invalid";
 			return os << "; type: Calculated; code: " << std::quoted(r.nameOrCode) << " resultType: " << typeName << '}';
 		}
@@ -214,6 +258,7 @@ namespace WASimCommander
 	/// Data structure for sending Key Events to the sim with up to 5 event values. Events are specified using numeric MSFS Event IDs (names can be resolved to IDs via `Lookup` command).
 	/// This supports the new functionality in MSFS SU10 with `trigger_key_event_EX1()` Gauge API function (similar to `SimConnect_TransmitClientEvent_EX1()`).
 	/// The server will respond with an Ack/Nak for a `SendKey` command, echoing the given `token`. For events with zero or one value, the `SendKey` command can be used instead.
+	/// Bursts of events are more efficiently sent via the "key event queue" data area, see `KeyEventQueueHeader`.
 	/// \since v1.1.0  \sa Enums::CommandId::SendKey, Enums::CommandId::Lookup
 	struct WSMCMND_API KeyEvent
 	{
@@ -246,6 +291,163 @@ namespace WASimCommander
 	};
 
 
+	/// Header of a block of data value updates which the server writes to the "packed data" area when the \refwce{ClientOption::PackedDataUpdates} option is enabled for a client.
+	/// The header is followed by `recordCount` value records, each one consisting of a `PackedDataRecord` struct immediately followed by `PackedDataRecord::dataSize` bytes of value data.
+	/// The data area is always written in full (\refwc{PACKED_DATA_AREA_SIZE} bytes), any space after the last record is unused.
+	/// \since v1.4.0  \sa Enums::ClientOption::PackedDataUpdates
+	struct WSMCMND_API PackedDataHeader
+	{
+		uint32_t sequence;     ///< Incremented by the server with each block written, may be used to detect missed updates.
+		uint16_t recordCount;  ///< Number of value records following this header.
+		uint16_t dataSize;     ///< Total size of all value records following this header, in bytes.
+		                       //  8/8 B (packed/unpacked), 8/16 B aligned
+	};
+
+	/// Header of one value record in a packed data value update block. \sa PackedDataHeader  \since v1.4.0
+	struct WSMCMND_API PackedDataRecord
+	{
+		uint32_t requestId;  ///< The `DataRequest::requestId` which the value belongs to.
+		uint32_t dataSize;   ///< Size of the value data which immediately follows this record header, in bytes. This is the actual value size of the corresponding `DataRequest`.
+		                     //  8/8 B (packed/unpacked), 8/16 B aligned
+	};
+
+
+	/// Header of a block of `List` command results which the server writes to the "list data" area when packed results are requested (with a non-zero `fData` value in the `List` command).
+	/// The header is followed by `itemCount` items, each one consisting of a 32-bit signed integer item ID immediately followed by the item name as a null-terminated string.
+	/// The data area is always written in full (\refwc{LIST_DATA_AREA_SIZE} bytes), any space after the last item is unused.
+	/// \since v1.4.0  \sa Enums::CommandId::List
+	struct WSMCMND_API ListDataHeader
+	{
+		uint32_t token;      ///< The `Command::token` of the `List` command which the results belong to.
+		uint16_t itemCount;  ///< Number of items following this header.
+		uint16_t dataSize;   ///< Total size of all items following this header, in bytes.
+		                     //  8/8 B (packed/unpacked), 8/16 B aligned
+	};
+
+
+	/// Header of a batch of log records which the server writes to the "log data" area when the \refwce{ClientOption::PackedLogRecords} option is enabled for a client.
+	/// The header is followed by `recordCount` log records, each one consisting of a `LogDataRecord` struct immediately followed by `LogDataRecord::messageSize` bytes of null-terminated message text.
+	/// The data area is always written in full (\refwc{LOG_DATA_AREA_SIZE} bytes), any space after the last record is unused.
+	/// \since v1.4.0  \sa Enums::ClientOption::PackedLogRecords
+	struct WSMCMND_API LogDataHeader
+	{
+		uint32_t sequence;     ///< Incremented by the server with each batch written, may be used to detect missed batches.
+		uint16_t recordCount;  ///< Number of log records following this header.
+		uint16_t dataSize;     ///< Total size of all records following this header, in bytes.
+		                       //  8/8 B (packed/unpacked), 8/16 B aligned
+	};
+
+	/// Header of one record in a packed log record batch. \sa LogDataHeader  \since v1.4.0
+	struct WSMCMND_API LogDataRecord
+	{
+		time_t timestamp;      ///< ms since epoch.
+		WSE::LogLevel level;   ///< Message severity.
+		uint8_t reserved;      ///< Unused, always zero.
+		uint16_t messageSize;  ///< Size of the message text which immediately follows this record header, including the null terminator.
+		                       //  12/16 B (packed/unpacked), 4/16 B aligned
+	};
+
+
+	/// Header of a batch of commands which a Client writes to its "command batch" data area, and of a block of responses which the server writes to the Client's "batch results" area.
+	/// The header is followed by `recordCount` records, each one consisting of a `CommandBatchRecord` struct immediately followed by `CommandBatchRecord::sDataSize` bytes of `Command::sData` contents.
+	/// The data areas are always written in full (\refwc{COMMAND_BATCH_AREA_SIZE} bytes), any space after the last record is unused. The results of one batch may span several blocks,
+	/// and an `Ack` response with a \refwce{CommandId::Batch} ID is sent after the last one.
+	/// \since v1.4.0  \sa Enums::CommandId::Batch, WASimClient::sendCommands()
+	struct WSMCMND_API CommandBatchHeader
+	{
+		uint32_t token;        ///< Unique ID of the batch, chosen by the Client. Echoed back in the result blocks and the final `Ack/Nak` response.
+		uint16_t recordCount;  ///< Number of command records following this header.
+		uint16_t dataSize;     ///< Total size of all records following this header, in bytes.
+		                       //  8/8 B (packed/unpacked), 8/16 B aligned
+	};
+
+	/// Header of one command (or response) record in a command batch or batch results block. The fields correspond to the same-named `Command` members. \sa CommandBatchHeader  \since v1.4.0
+	struct WSMCMND_API CommandBatchRecord
+	{
+		uint32_t token;             ///< \refwc{Command::token}
+		uint32_t uData;             ///< \refwc{Command::uData}
+		double fData;               ///< \refwc{Command::fData}
+		WSE::CommandId commandId;   ///< \refwc{Command::commandId}
+		uint8_t reserved;           ///< Unused, always zero.
+		uint16_t sDataSize;         ///< Size of the `Command::sData` contents which immediately follow this record header, less than \refwc{STRSZ_CMD}. Trailing zero bytes are omitted (a string's null terminator is not included).
+		                            //  20/24 B (packed/unpacked), 4/8 B aligned
+	};
+
+
+	/// Header of the "key event queue" data area, which holds a ring buffer of the last \refwc{KEY_EVENT_QUEUE_SIZE} `KeyEvent`s written by a Client. The header is followed by the `KeyEvent` slots.
+	/// The Client writes each new event into slot `(writeSequence - 1) % KEY_EVENT_QUEUE_SIZE` after incrementing `writeSequence`, and then writes the whole area.
+	/// The server triggers all the events which it has not seen yet each time the area is written, so events written in quick succession are processed together even if some of the writes are merged,
+	/// and responds with a single `Ack` for a `SendKey` command with the `token` of the last processed event and the number of processed events in `fData`. A `Nak` is still sent for each invalid event.
+	/// If more than \refwc{KEY_EVENT_QUEUE_SIZE} events were written between two reads, the server sends a `Nak` with the `token` of the oldest remaining event and the number of dropped events in `fData`.
+	/// The queue is only read once the Client enables it with \refwce{ClientOption::KeyEventQueue}, at which point the sequence restarts from zero. The data area is always written in full (\refwc{KEY_EVENT_QUEUE_AREA_SIZE} bytes).
+	/// \since v1.4.0  \sa KeyEvent, WASimClient::sendKeyEvent()
+	struct WSMCMND_API KeyEventQueueHeader
+	{
+		uint32_t writeSequence;  ///< Total number of events written since the client connected. Sequence `1` is the first event.
+		uint32_t reserved;       ///< Unused, should be zero.
+		                         //  8/8 B (packed/unpacked), 8/16 B aligned
+	};
+
+	/// Header of a block of local variable values which a Client writes to its "setter stream" data area. The header is followed by `recordCount` `SetterStreamRecord` structs.
+	/// The server applies the values once per simulator frame, without sending any response. If the same variable is written more than once before then, only the latest value is applied.
+	/// The data area is always written in full (\refwc{SETTER_STREAM_AREA_SIZE} bytes), any space after the last record is unused.
+	/// \since v1.4.0  \sa WASimClient::streamLocalVariables()
+	struct WSMCMND_API SetterStreamHeader
+	{
+		uint32_t recordCount;  ///< Number of records following this header, up to \refwc{SETTER_STREAM_MAX_RECORDS}.
+		uint32_t reserved;     ///< Unused, should be zero.
+		                       //  8/8 B (packed/unpacked), 8/16 B aligned
+	};
+
+	/// One local variable value in a "setter stream" block, using pre-resolved numeric IDs (which can be found with the `Lookup` command). \sa SetterStreamHeader  \since v1.4.0
+	struct WSMCMND_API SetterStreamRecord
+	{
+		int32_t variableId;   ///< Local variable ID, as returned by a \refwce{LookupItemType::LocalVariable} lookup.
+		int32_t unitId = -1;  ///< Unit ID, as returned by a \refwce{LookupItemType::UnitType} lookup, or `-1` to set the value without a unit type.
+		double value;         ///< The value to set.
+		                      //  16/16 B (packed/unpacked), 8/16 B aligned
+	};
+
+
+	/// Performance statistics of a Client or one of its Data Requests, as collected by the server (WASM module). A series of these records is sent in response to the \refwce{CommandId::Stats} command.
+	/// All times are in microseconds. Counters accumulate from the time a Client connects (or a request is added) until they are reset with the `Stats` command.
+	/// \since v1.4.0  \sa WASimClient::serverStats()
+	struct WSMCMND_API StatsRecord
+	{
+		uint32_t clientId = 0;          ///< ID of the Client which the statistics belong to.
+		uint32_t requestId = -1;        ///< `DataRequest::requestId` for request statistics, or `-1` (`0xFFFFFFFF`) for the totals of all the Client's requests and commands.
+		uint64_t evalCount = 0;         ///< Number of value evaluations (calculator code executions or variable reads). Results shared between clients from the same update cycle are not counted.
+		uint64_t evalTimeTotal = 0;     ///< Cumulative value evaluation time.
+		uint32_t evalTimeMax = 0;       ///< Longest single value evaluation time.
+		uint32_t commandTimeMax = 0;    ///< Longest time spent processing a single command. Client totals only.
+		uint64_t writeCount = 0;        ///< Number of value updates sent to the Client.
+		uint64_t suppressedCount = 0;   ///< Number of value changes which were not sent because they were within the request's `deltaEpsilon`.
+		uint64_t commandCount = 0;      ///< Number of commands processed. Client totals only.
+		uint64_t commandTimeTotal = 0;  ///< Cumulative command processing time. Client totals only.
+		uint64_t throttledCount = 0;    ///< Number of update cycles in which some of the Client's due value updates were deferred to the next cycle because the server's per-client update or data size limit was reached. Client totals only.
+		uint64_t updateCount = 0;       ///< Number of scheduled value checks processed, according to the request's `period` and `interval`.
+		uint64_t updateLagTotal = 0;    ///< Cumulative delay between the time scheduled value checks were due and the start of the update cycle in which they were processed.
+		uint32_t updateLagMax = 0;      ///< Longest delay of a single scheduled value check. \sa DataRequest::priority
+		uint32_t lateCount = 0;         ///< Number of scheduled value checks which were processed more than one tick period (\refwc{TICK_PERIOD_MS}) after they were due, eg. because of the server's
+		                                ///  frame time budget or per-client limits, or the request's priority class.
+		uint64_t keyEventCount = 0;     ///< Number of Key Events triggered. Client totals only.
+		uint64_t coalescedCount = 0;    ///< Number of Key Event triggers saved by merging coalescable events (see \refwce{ClientOption::CoalesceKeyEvent}). Client totals only.
+		                                //  112/112 B (packed/unpacked), 8/16 B aligned
+
+		friend inline std::ostream& operator<<(std::ostream& os, const StatsRecord &s) {
+			os << "StatsRecord{client: " << std::hex << std::uppercase << s.clientId << std::dec << std::nouppercase;
+			if (s.requestId != (uint32_t)-1)
+				os << "; request: " << s.requestId;
+			os << "; evals: " << s.evalCount << "; evalTime: " << s.evalTimeTotal << "us; evalMax: " << s.evalTimeMax << "us; writes: " << s.writeCount << "; suppressed: " << s.suppressedCount;
+			if (s.requestId == (uint32_t)-1)
+				os << "; commands: " << s.commandCount << "; cmdTime: " << s.commandTimeTotal << "us; cmdMax: " << s.commandTimeMax << "us; throttled: " << s.throttledCount
+				   << "; keyEvents: " << s.keyEventCount << "; coalesced: " << s.coalescedCount;
+			os << "; updates: " << s.updateCount << "; lag: " << s.updateLagTotal << "us; lagMax: " << s.updateLagMax << "us; late: " << s.lateCount;
+			return os << '}';
+		}
+	};
+
+
 	/// Log record structure. \sa WASimCommander:CommandId::Log command.
 	struct WSMCMND_API LogRecord
 	{
@@ -253,6 +253,19 @@ static const uint32_t CUSTOM_KEY_EVENT_ID_MIN = 0x00020000;
 		/// \return `S_OK` on success, `E_INVALIDARG` on parameter validation errors, `E_NOT_CONNECTED` if not connected to server, or `E_FAIL` on general failure (unlikely).
 		/// \sa \refwce{CommandId::SetCreate}
 		HRESULT setOrCreateLocalVariable(const std::string &variableName, const double value, const std::string &unitName = std::string());
+		/// Sets a Local variable value using pre-resolved numeric IDs via the low-overhead "setter stream" channel. Intended for high rate updates such as joystick axis positions.
+		/// The value is written in a small fixed-size block instead of a full `Command`, the server applies it on the next simulator frame without any name parsing, and no response is sent.
+		/// If the same variable is written several times before the next frame, only the latest value is applied.
+		/// \param variableId The local variable ID, as returned by `lookup()` with \refwce{LookupItemType::LocalVariable}.
+		/// \param value The value to set.
+		/// \param unitId Optional unit ID, as returned by `lookup()` with \refwce{LookupItemType::UnitType}, or `-1` (default) to set the value without a unit type.
+		/// \return `S_OK` on success, `E_INVALIDARG` if `variableId` is negative, `E_NOT_CONNECTED` if not connected to server, or `E_FAIL` on general failure (unlikely).
+		/// \note Since there is no response, invalid IDs are only reported in the server's log. Servers older than v1.4.0 ignore streamed values.  \sa SetterStreamHeader  \since v1.4.0
+		HRESULT streamLocalVariable(int32_t variableId, double value, int32_t unitId = -1) const;
+		/// Sets several Local variable values at once via the "setter stream" channel, writing as few blocks as possible. See `streamLocalVariable()` for details.
+		/// \return `S_OK` on success, `E_INVALIDARG` if `values` is empty or has a negative variable ID, `E_NOT_CONNECTED` if not connected to server, or `E_FAIL` on general failure (unlikely).
+		/// \since v1.4.0
+		HRESULT streamLocalVariables(const std::vector<SetterStreamRecord> &values) const;
 
 		/// Sets a numeric value on an 'A' (aka "SimVar" / "Simulator Variable") type variable. \n
 		/// This is a convenience version of `setVariable()`, equivalent to `setVariable(VariableRequest(variableName, unitName), value)`. See `setVariable()` and `VariableRequest` for details.\n
@@ -322,6 +335,39 @@ static const uint32_t CUSTOM_KEY_EVENT_ID_MIN = 0x00020000;
 		/// \return `S_OK` on success; If currently connected to the server, may also return `E_TIMEOUT` on general server communication failure.
 		HRESULT setDataRequestsPaused(bool paused) const;
 
+		/// Enables or disables "packed" data value updates. When enabled, the server combines all data request value updates from one processing cycle into as few writes as possible, using one shared data area,
+		/// instead of writing each changed value to the request's own data area. This can greatly reduce the number of SimConnect messages when many values change at the same time.
+		/// The values are delivered to the `dataCallback` and stored in the data requests the same way as without this option, so this setting is transparent to the rest of the API.\n
+		/// Note that with servers older than v1.4.0 positive `DataRequest::deltaEpsilon` values are only applied by SimConnect to each request's own data area, and are therefore not in effect for values delivered as packed updates.
+		/// Newer servers apply the `deltaEpsilon` themselves before sending any value updates.\n
+		/// This method can be called while not connected to the server. In this case the setting is saved and sent to the server upon next connection, before sending any data request subscriptions.
+		/// \return `S_OK` on success; `E_FAIL` if the server rejected the option (for example an older server version which doesn't support it); If currently connected to the server, may also return `E_TIMEOUT` on general server communication failure.
+		/// \since v1.4.0
+		HRESULT setPackedDataUpdates(bool enable);
+		/// Returns the current "packed data updates" setting. \sa setPackedDataUpdates() \since v1.4.0
+		bool packedDataUpdates() const;
+
+		/// Sets a maximum time between data value updates from the server. Values of active data requests are sent again after this time even if they have not changed
+		/// (or changed by less than the request's `deltaEpsilon`), which lets a client detect stale values or simply refresh its state periodically.
+		/// Only requests which are checked at least this often, based on their `period` and `interval` settings, are affected. The default of `0` disables the heartbeat updates.\n
+		/// This method can be called while not connected to the server, in which case the setting is saved and sent to the server upon next connection.
+		/// \return `S_OK` on success; `E_FAIL` if the server rejected the option (eg. an older server version); If currently connected to the server, may also return `E_TIMEOUT` on general server communication failure.
+		/// \since v1.4.0
+		HRESULT setDataUpdateHeartbeat(uint32_t intervalMs);
+		/// Returns the current data update heartbeat interval in milliseconds, zero if disabled. \sa setDataUpdateHeartbeat() \since v1.4.0
+		uint32_t dataUpdateHeartbeat() const;
+
+		/// Sets a hysteresis factor for `DataRequest::deltaEpsilon` value change filtering. When a value changes in the opposite direction of its previously sent change,
+		/// the change must exceed `deltaEpsilon * (1 + factor)` before it is sent. This helps suppress updates of values which jitter around some point.
+		/// The default of `0` disables hysteresis (values are sent whenever they change by more than `deltaEpsilon` in either direction).\n
+		/// This method can be called while not connected to the server, in which case the setting is saved and sent to the server upon next connection.
+		/// \return `S_OK` on success; `E_INVALIDARG` if the factor is negative; `E_FAIL` if the server rejected the option (eg. an older server version);
+		///   If currently connected to the server, may also return `E_TIMEOUT` on general server communication failure.
+		/// \since v1.4.0
+		HRESULT setDeltaEpsilonHysteresis(float factor);
+		/// Returns the current `deltaEpsilon` hysteresis factor. \sa setDeltaEpsilonHysteresis() \since v1.4.0
+		float deltaEpsilonHysteresis() const;
+
 		/// \}
 		/// \name RPN calculator code execution and reusable events
 		/// \{
@@ -374,7 +420,9 @@ static const uint32_t CUSTOM_KEY_EVENT_ID_MIN = 0x00020000;
 		///   (from [their docs](https://docs.flightsimulator.com/html/Programming_Tools/WASM/Gauge_API/trigger_key_event_EX1.htm#return_values): "If the event requested is not appropriate, it will simply not happen."). \n\n
 		///   For _custom named_ events, triggered via `SimConnect_TransmitClientEvent[_EX1()]`, SimConnect may asynchronously send EXCEPTION type response messages if the ID isn't valid
 		///   (likely because the event hasn't been successfully registered with `registerCustomKeyEvent()`). These messages are passed through to WASimClient's logging facilities at the `Warning` level.
-		///   But again there is no actual confirmation that the event is going to do anything.
+		///   But again there is no actual confirmation that the event is going to do anything. \n\n
+		///   Since v1.4.0 the events are sent via the server's "key event queue" (see `WASimCommander::KeyEventQueueHeader`), and events sent in quick succession may be answered by one `Ack`
+		///   with the `token` of the last event and the number of events in `fData`. With servers older than v1.4.0, which do not support the key event queue, each event is sent and answered individually.
 		/// \since v1.3.0 - Added ability to trigger custom named events.
 		HRESULT sendKeyEvent(uint32_t keyEventId, uint32_t v1 = 0, uint32_t v2 = 0, uint32_t v3 = 0, uint32_t v4 = 0, uint32_t v5 = 0) const;
 
@@ -395,6 +443,25 @@ static const uint32_t CUSTOM_KEY_EVENT_ID_MIN = 0x00020000;
 		/// \since v1.3.0 - Added ability to trigger custom named events.
 		HRESULT sendKeyEvent(const std::string &keyEventName, uint32_t v1 = 0, uint32_t v2 = 0, uint32_t v3 = 0, uint32_t v4 = 0, uint32_t v5 = 0);
 
+		/// Sends several Key Events at once. This is more efficient than calling `sendKeyEvent()` for each event since up to \refwc{KEY_EVENT_QUEUE_SIZE} events are written to the server together
+		/// in one update of the "key event queue" (see `WASimCommander::KeyEventQueueHeader`). Servers older than v1.4.0 do not support the queue and the events are then written one at a time. \n
+		/// Events with a `token` of zero are assigned one automatically. Only standard Key Event IDs are supported (not custom named event IDs).
+		/// \return `S_OK` on success, `E_INVALIDARG` if `events` is empty or any event ID is zero or a custom event ID (in which case nothing is sent), `E_NOT_CONNECTED` if not connected to the server,
+		/// or `E_FAIL` on unexpected SimConnect error.
+		/// \sa sendKeyEvent(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) const for details about responses.  \since v1.4.0
+		HRESULT sendKeyEvents(const std::vector<KeyEvent> &events) const;
+
+		/// Marks a Key Event ID as "coalescable" (or removes the mark), meaning that if it is sent several times per simulator frame with `sendKeyEvent()`, the server only triggers it once with the latest value.
+		/// This is meant for "axis" type events, eg. `AXIS_ELEVATOR_SET` or `THROTTLE_SET`, which may be sent at a higher rate than the simulator can use them. Events are coalesced only if their `v2`-`v5` values are the same.
+		/// Coalesced events are triggered on the next server update "tick" instead of immediately, and the number of events saved this way is reported in \refwc{StatsRecord::coalescedCount}.
+		/// Only applies to events sent by ID (not custom named events). The setting is saved and sent to the server again when reconnecting. \n
+		/// Note that the server acknowledges a coalescable event as soon as it is buffered. An event which is replaced by a newer one before it is triggered is therefore still acknowledged, but never actually triggered.
+		/// \return `S_OK` on success, `E_INVALIDARG` if the ID is zero or a custom event ID, `E_FAIL` if the server rejected the option (eg. servers older than v1.4.0), or `E_TIMEOUT` on server communication failure.
+		/// \sa \refwce{ClientOption::CoalesceKeyEvent}  \since v1.4.0
+		HRESULT setKeyEventCoalescing(uint32_t keyEventId, bool coalesce = true);
+		/// Returns true if the given Key Event ID has been marked as coalescable with `setKeyEventCoalescing()`. \since v1.4.0
+		bool keyEventCoalescing(uint32_t keyEventId) const;
+
 		/// Register a "Custom Simulator [Key] Event" by providing an event name. The method optionally returns the generated event ID, which can later be used with `sendKeyEvent()` method instead of the event name.
 		/// It can also be used to look up a previous registration's ID if the event name has already been registered. \n\n
 		/// Custom event names are mapped to internally-generated unique IDs using a standard SimConnect call to
@@ -440,6 +507,14 @@ static const uint32_t CUSTOM_KEY_EVENT_ID_MIN = 0x00020000;
 		/// (which may be `S_OK`, `E_FAIL` if server returned `Nak`, or `E_TIMEOUT` if the list request did not complete (results may be empty or partial)).
 		/// \sa \refwce{CommandId::List}
 		HRESULT list(WASimCommander::Enums::LookupItemType itemsType = WASimCommander::Enums::LookupItemType::LocalVariable);
+		/// Send a request for a partial list of items to the server, for example to page through a long list of local variables. The results are delivered the same way as with `list(LookupItemType)`.
+		/// \param itemsType The type of thing to list, same as for `list(LookupItemType)`.
+		/// \param startIndex Index of the first item to list, counting from zero in the order in which the server lists the items (for local variables this is the same as the variable ID).
+		/// \param count The maximum number of items to list, or zero to list all items starting from `startIndex`.
+		/// \return  `S_OK` on success, `E_INVALIDARG` if the item type is not supported, `E_NOT_CONNECTED` if not connected to server.
+		/// \note Servers older than v1.4.0 ignore the range parameters and always send the full list.
+		/// \since v1.4.0
+		HRESULT list(WASimCommander::Enums::LookupItemType itemsType, uint32_t startIndex, uint32_t count);
 
 		/// Request a lookup of a named item to find its corresponding numeric ID. \n
 		/// Most lookup types are done on the server side, so an active connection is required. The exception is looking up Key Event IDs (\refwce{LookupItemType::KeyEventId}), which are performed locally.
@@ -450,6 +525,17 @@ static const uint32_t CUSTOM_KEY_EVENT_ID_MIN = 0x00020000;
 		/// \note Except for Key Event ID type lookups, this method blocks until either the Server responds or the timeout has expired. \sa defaultTimeout(), setDefaultTimeout()
 		HRESULT lookup(WASimCommander::Enums::LookupItemType itemType, const std::string &itemName, int32_t *piResult);
 
+		/// Request performance statistics from the server. The results contain one `StatsRecord` with the totals for this Client, followed by one record for each of its Data Requests,
+		/// or the same records for each connected Client if `allClients` is `true`. This can help find which client or which calculator code is using the most of the simulator's frame time.
+		/// \param stats Pointer to a vector which will be populated with the results (any existing contents are replaced).
+		/// \param resetCounters If `true` then the server will reset this Client's counters to zero after reporting them. Other Clients' counters are not affected.
+		/// \param allClients If `true` then the results include the records of all connected Clients instead of only this one.
+		/// \return `S_OK` on success, `E_INVALIDARG` if `stats` is null or another stats request is pending, `E_FAIL` if server returns a Nak response (eg. an older server version),
+		///   `E_NOT_CONNECTED` if not connected to server, `E_TIMEOUT` on server communication failure.
+		/// \note This method blocks until either the Server responds or the timeout has expired. \sa \refwce{CommandId::Stats}, defaultTimeout(), setDefaultTimeout()
+		/// \since v1.4.0
+		HRESULT serverStats(std::vector<StatsRecord> *stats, bool resetCounters = false, bool allClients = false);
+
 		/// \}
 		/// \name Low level API
 		/// \{
@@ -465,6 +551,27 @@ static const uint32_t CUSTOM_KEY_EVENT_ID_MIN = 0x00020000;
 		/// \param timeout The maximum time to wait for a response, in milliseconds. If `0` (default) then the default network timeout value is used (`defaultTimeout()`, `setDefaultTimeout()`).
 		/// \return `S_OK` on success, `E_NOT_CONNECTED` if not connected to server, `E_TIMEOUT` on server communication failure, or possibly `E_FAIL` on unknown error (check log for details).
 		HRESULT sendCommandWithResponse(const Command &command, Command *response, uint32_t timeout = 0);
+		/// Sends a batch of commands to the server, which runs them in order within one processing cycle, and waits for all the results. This is more efficient than sending each command separately when several are needed at once.
+		/// The commands are sent via the "command batch" data area (see `WASimCommander::CommandBatchHeader`), and automatically split into several batches if they do not all fit into one.
+		/// \param commands The `Command` structs to send. `List` and `Disconnect` commands cannot be batched and will be answered with a `Nak` response.
+		/// \param responses Optional pointer to a vector for storing all the responses to the commands, in the order they were sent by the server. Typically this is one `Ack` or `Nak` per command, but some commands (eg. `Stats`) produce several responses.
+		///   The responses are also passed to the command result callback, if one is set, the same as for individually sent commands.
+		/// \param timeout The maximum time to wait for the results of each batch, in milliseconds. If `0` (default) then the default network timeout value is used (`defaultTimeout()`, `setDefaultTimeout()`).
+		/// \return `S_OK` on success, `E_INVALIDARG` if `commands` is empty or another batch is still pending, `E_NOT_CONNECTED` if not connected to server, `E_TIMEOUT` on server communication failure,
+		///   or `E_FAIL` if the server rejected a batch (check log for details). Note that success only means that all the commands were processed, check the individual `responses` for their results.
+		/// \note This method blocks until either the Server responds or the timeout has expired. Servers older than v1.4.0 do not support command batches.  \sa \refwce{CommandId::Batch}
+		/// \since v1.4.0
+		HRESULT sendCommands(const std::vector<Command> &commands, std::vector<Command> *responses = nullptr, uint32_t timeout = 0);
+		/// Enables or disables "fire and forget" command mode, in which the server does not send `Ack` responses for successful commands that return no result data.
+		/// This affects `Set`, `SetCreate`, `Transmit`, `SendKey` and `Update` commands, plus `Exec` commands with a `CalcResultType::None` result type, which includes the commands sent by `setVariable()`, `setLocalVariable()`,
+		/// `sendKeyEvent()`, `transmitEvent()`, `updateDataRequest()` and `executeCalculatorCode()` (without a result). `Nak` responses are still sent for any errors, and all other commands are answered as usual.
+		/// Commands sent together with `sendCommands()` are always answered, so their responses can be matched to the commands. The setting is saved and sent to the server again when reconnecting. Disabled by default.
+		/// \return `S_OK` on success, `E_FAIL` if the server rejected the option (eg. servers older than v1.4.0), or `E_TIMEOUT` on server communication failure.
+		/// \note Do not wait for responses to the affected commands (eg. with `sendCommandWithResponse()`) while this mode is enabled, since successful ones will never arrive.
+		/// \sa \refwce{ClientOption::SuppressAcks}  \since v1.4.0
+		HRESULT setSuppressCommandAcks(bool suppress);
+		/// Returns true if "fire and forget" command mode is enabled. \sa setSuppressCommandAcks() \since v1.4.0
+		bool suppressCommandAcks() const;
 
 		/// \}
 		/// \name  Logging settings
@@ -95,6 +95,36 @@ struct WSMCMND_API DataRequestRecord : public DataRequest
 		return ret;
 	}
 
+	/// Tries to populate a vector with the values of an array result, such as from an indexed-range SimVar request (see `DataRequest::simVarIndexCount`), and returns true or false
+	/// depending on if the conversion was valid (meaning the data size is a non-zero multiple of the size of the requested type). If the conversion fails, the vector is not changed.
+	/// The value type must be trivially copyable, (eg. numerics, chars). \since v1.4.0
+	template<typename T, std::enable_if_t<std::is_trivially_copyable_v<T>, bool> = true>
+	inline bool tryConvertArray(std::vector<T> &result) const {
+		bool ret;
+		if ((ret = !data.empty() && !(data.size() % sizeof(T)))) {
+			result.resize(data.size() / sizeof(T));
+			memcpy(result.data(), data.data(), data.size());
+		}
+		return ret;
+	}
+
+	/// Returns the values of an array result as a vector of the requested type, or an empty vector if the conversion would be invalid. \sa tryConvertArray() \since v1.4.0
+	template<typename T, std::enable_if_t<std::is_trivially_copyable_v<T>, bool> = true>
+	inline std::vector<T> toArray() const {
+		std::vector<T> ret;
+		tryConvertArray(ret);
+		return ret;
+	}
+
+	/// Returns the value at `index` of an array result, or a default-constructed value if the index is out of range of the data size. \since v1.4.0
+	template<typename T, std::enable_if_t<std::is_trivially_copyable_v<T>, bool> = true, std::enable_if_t<std::is_default_constructible_v<T>, bool> = true>
+	inline T arrayValue(size_t index) const {
+		T ret = T();
+		if ((index + 1) * sizeof(T) <= data.size())
+			memcpy(&ret, data.data() + index * sizeof(T), sizeof(T));
+		return ret;
+	}
+
 	// The c'tors and assignments are primarily for internal use and container storage requirements, but may also be useful for subclasses.
 	using DataRequest::DataRequest;   ///< Inherits DataRequest constructors.
 	using DataRequest::operator=;     ///< Inherits DataRequest assignment operators.
@@ -45,6 +45,10 @@ namespace WSMCMND_ENUM_NAMESPACE
 		Disconnect,   ///< Stop data updates for this client. Use the `Connect` command to resume updates. The server may also spontaneously send a Disconnect command in case it is shutting down or otherwise terminating connections.
 		List,         ///< Request a listing of items like local variables. `uData` should be one of `WASimCommander::LookupItemType` enum values (Sim and Token vars currently cannot be listed).
 		              ///  List is returned as a series of `List` type response commands with `sData` as var name and `uData` is var ID, followed by an `Ack` at the end. A `Nak` response is returned if the item type cannot be listed for any reason.
+		              ///  If `fData` is non-zero then the results are instead written in blocks of many items to the Client's "list data" area, which the client must create beforehand (see `ListDataHeader` for format).
+		              ///  The `Ack` is still sent at the end. Servers older than v1.4.0 ignore `fData` and always send the individual `List` responses. \since v1.4.0 (`fData` option)
+		              ///  Optionally `sData` may specify a range of items to list as "<start_index>[,<count>]", where a `count` of zero lists all remaining items. Long lists of local variables are sent over several
+		              ///  server update cycles, and only one List command per Client can be in progress at any time. \since v1.4.0 (`sData` range and incremental processing)
 		Lookup,       ///< Get information about an item, such as the ID of a variable or unit name. `uData` should be one of `WASimCommander::LookupItemType` enum values and `sData` is the name of the thing to look up.
 		              ///  `Ack` is returned on success with the ID of the variable/unit in the `fData` member (as an `INT32`) and the original requested string name echoed back in `sData`. In case of lookup failure, a `Nak` response is returned with possible reason in `sData`.
 		Get,          ///< Get a named variable value with optional unit type. `uData` is a char of the variable type, eg. 'L' for local, 'A' for SimVar, or 'T' for Token. Only 'L', 'A' and 'E' types support unit specifiers.\n
@@ -80,16 +84,27 @@ namespace WSMCMND_ENUM_NAMESPACE
 		              ///  "The send_key_event function transmits a WM_COMMAND application event. This function transmits a message with the following syntax: `PostMessage(hwndMain, WM_COMMAND, event_id, (LPARAM) value);`"\n\n
 		              ///  In practice this means you can send a KEY Event ID directly to the simulator, bypassing SimConnect event name mappings or calculator code evaluation. The event IDs can be found in the MSFS SDK's `MSFS/Legacy/gauges.h` header file as `KEY_*` macros,
 		              ///  and are also available via the `Lookup` command. If this command is sent with `uData` == 0 and `sData` contains a string, a `LookupItemType::KeyEventId` lookup will be performed on the Key Event name first and the resulting ID (if any) used.\n\n
-		              ///  Custom event IDs (registered by gauges or other modules) can also be triggered this way. There may be other uses for this command... TBD.
+		              ///  Custom event IDs (registered by gauges or other modules) can also be triggered this way. There may be other uses for this command... TBD.\n\n
+		              ///  Events which the Client marked as coalescable (see `ClientOption::CoalesceKeyEvent`) are acknowledged when they are buffered, before they are triggered.
 		Log,          ///< Set severity level for logging to the Client's `LogRecord` data area. `uData` should be one of the `WASimCommander::LogLevel` enum values. `LogLevel::None` disables logging, which is also the initial default for a newly connected Client.
 		              ///  Additionally, the server-wide log levels can be set for the file and console loggers independently. To specify these levels, set `fData` to one of the `WASimCommander::LogFacility` enum values. The default of `0` assumes `LogFacility::Remote`.
+		Option,       ///< Set a Client-specific option. `uData` should be one of the `WASimCommander::Enums::ClientOption` enum values and `fData` is the value to set (for on/off type options `0` disables and any other value enables the option).
+		              ///  An `Ack` response is returned on success, or a `Nak` if the option is unknown or could not be set (servers older than v1.4.0 will always respond with a `Nak`). \since v1.4.0
+		Stats,        ///< Request performance statistics collected by the server for the requesting Client and its Data Requests, or for all connected Clients if `fData` is non-zero.
+		              ///  If `uData` is non-zero then the requesting Client's own counters are reset after being reported (other Clients' counters are never reset).
+		              ///  The server responds with a series of `Stats` commands with the same `token` as the original request, each containing one `WASimCommander::StatsRecord` structure in binary form in the `sData` member,
+		              ///  followed by an `Ack` when all records have been sent. \since v1.4.0
+		Batch,        ///< Used only in `Ack/Nak` responses to a batch of commands written to the Client's "command batch" data area (see `CommandBatchHeader` for format), with the `token` of the batch header.
+		              ///  The commands in a batch are processed in order within one server dispatch cycle and their responses are written in blocks to the Client's "batch results" area (which the client must create beforehand),
+		              ///  followed by an `Ack` when all results have been sent. A `Nak` is returned instead if the batch data is invalid or the results cannot be written.
+		              ///  `List` and `Disconnect` commands cannot be batched and are answered with a `Nak` result. Sending this command directly in a `Command` structure is also answered with a `Nak`. \since v1.4.0
 	};
 	/// \name Enumeration name strings
 	/// \{
 	static const std::vector<const char *> CommandIdNames = {
 		"None", "Ack", "Nak", "Ping", "Connect", "Disconnect", "List", "Lookup",
 		"Get", "GetCreate", "Set", "SetCreate", "Exec", "Register", "Transmit",
-		"Subscribe", "Update", "SendKey", "Log" };  ///< \refwc{Enums::CommandId} enum names.
+		"Subscribe", "Update", "SendKey", "Log", "Option", "Stats", "Batch" };  ///< \refwc{Enums::CommandId} enum names.
 	/// \}
 
 	/// Types of things to request or set. \sa DataRequest struct.
@@ -97,11 +112,19 @@ namespace WSMCMND_ENUM_NAMESPACE
 	{
 		None = 0,   ///< Use to remove a previously-added request.
 		Named,      ///< A named variable.
-		Calculated  ///< Calculator code.
+		Calculated, ///< Calculator code.
+		Group,      ///< A group ("record set") of values which are evaluated together and written as one record to this request's data area. The member values are defined in `nameOrCode`,
+		            ///  one per line (separated by `\n`), as `<valueType>;<type>;<nameOrCode>[;<unitName>[;<deltaEpsilon>]]`, eg. `"double;A;PLANE ALTITUDE;feet\nint32;Integer;(L:MyVar) 2 *"`.
+		            ///  `valueType` is one of `int8`, `int16`, `int32`, `int64`, `float`, `double`, or a size in bytes for a string value. `type` is either a variable type letter, as in `varTypePrefix`,
+		            ///  or a `CalcResultType` name for calculator code. An `A` var name may end with a `:<index>`. The whole list may be prefixed with a `+` to have the record start with a bitmap of
+		            ///  changed members (one bit per member in list order, lowest bit first, `(memberCount + 7) / 8` bytes). The member values follow, each one of its value type's size, with no padding.
+		            ///  Members have no data areas of their own. Each member's `deltaEpsilon` determines if its value changed, and the record is sent when any member changes; a negative group
+		            ///  `deltaEpsilon` sends the record on every update. The group's `minUpdateInterval` and `maxUpdateInterval` apply to the record, and members are counted in the group's statistics.
+		            ///  `valueSize` must be large enough to hold the whole record. \since v1.4.0
 	};
 	/// \name Enumeration name strings
 	/// \{
-	static const std::vector<const char *> RequestTypeNames = { "None", "Named", "Calculated" };  ///< \refwc{Enums::RequestType} enum names.
+	static const std::vector<const char *> RequestTypeNames = { "None", "Named", "Calculated", "Group" };  ///< \refwc{Enums::RequestType} enum names.
 	/// \}
 
 	/// The type of result that calculator code is expected to produce. \sa DataRequest struct, Enums::CommandId::Exec command.
@@ -131,6 +154,19 @@ namespace WSMCMND_ENUM_NAMESPACE
 	static const std::vector<const char *> UpdatePeriodNames = { "Never", "Once", "Tick", "Millisecond" };  ///< \refwc{Enums::UpdatePeriod} enum names.
 	/// \}
 
+	/// Data Request update priority classes. When the server's per-frame processing time budget or per-client limits are reached, the remaining due updates are deferred
+	/// to the next frame, and higher priority updates are always processed first. \sa DataRequest::priority  \since v1.4.0
+	WSMCMND_ENUM_EXPORT enum class RequestPriority : uint8_t
+	{
+		Normal = 0,   ///< Default priority. Updated within the server's frame time budget, after any `High` priority requests.
+		High,         ///< Always updated when due, on every frame, regardless of the frame time budget and per-client limits. Use sparingly, eg. for values which drive external hardware.
+		Background,   ///< Updated with any time left in the frame budget after all due `Normal` priority requests, and with a reserved share of the budget (10% by default, depending on server configuration).
+	};
+	/// \name Enumeration name strings
+	/// \{
+	static const std::vector<const char *> RequestPriorityNames = { "Normal", "High", "Background" };  ///< \refwc{Enums::RequestPriority} enum names.
+	/// \}
+
 	/// Types of things to look up or list. \sa Enums::CommandId::List, Enums::CommandId::Lookup commands
 	WSMCMND_ENUM_EXPORT enum class LookupItemType : uint8_t
 	{
@@ -150,6 +186,36 @@ namespace WSMCMND_ENUM_NAMESPACE
 	};  ///< \refwc{Enums::LookupItemType} enum names.
 	/// \}
 
+	/// Client-specific options which can be changed with the `Enums::CommandId::Option` command. All options are disabled by default for a newly connected Client.
+	/// \since v1.4.0  \sa CommandId::Option command.
+	WSMCMND_ENUM_EXPORT enum class ClientOption : uint8_t
+	{
+		None = 0,           ///< Invalid option, ignored by server.
+		PackedDataUpdates,  ///< Write Data Request value updates into one shared "packed data" area ("WASimCommander.PackedData.<client_name>") instead of each request's own data area, combining all values
+		                    ///  which changed during one processing cycle into as few writes as possible. The client must create the data area before enabling this option. \sa PackedDataHeader struct.
+		UpdateHeartbeat,    ///< Maximum time, in milliseconds, between Data Request value updates. Values are sent again after this time even if they did not change (or changed by less than the request's `deltaEpsilon`).
+		                    ///  This only affects requests which are checked at least this often, according to their `period` and `interval`. `0` disables the heartbeat.
+		DeltaEpsilonHysteresis,  ///< Additional fraction of a request's `deltaEpsilon` which a value must change by when the change is in the opposite direction of the last sent change.
+		                         ///  For example `0.5` with a `deltaEpsilon` of `1.0` requires a change of more than `1.5` to reverse direction. Helps suppress values jittering around a point. `0` disables.
+		PackedLogRecords,   ///< Write log records sent to the Client (see `CommandId::Log`) in batches to the "log data" area ("WASimCommander.LogData.<client_name>") instead of one full size `LogRecord`
+		                    ///  at a time to the "log" area. The client must create the data area before enabling this option. \sa LogDataHeader struct.
+		                    ///  Only clients which enable this option get the variable-length records. Without it every record is still sent as a full size `LogRecord` to the "log" area,
+		                    ///  because that area's layout is fixed for existing clients. `WASimClient` creates the data area and enables this option automatically when it requests server logs.
+		SuppressAcks,       ///< Do not send `Ack` responses for successfully processed commands which do not return any result data: `Set`, `SetCreate`, `Transmit`, `SendKey` (including `KeyEvent` data),
+		                    ///  `Update`, and `Exec` with a `CalcResultType::None` result type. `Nak` responses are still sent for any errors. Useful for high rate "fire and forget" input commands.
+		                    ///  This does not apply to commands sent in a batch (see `CommandId::Batch`), whose results always contain an `Ack` or `Nak` for each command so they can be matched to the batch entries.
+		CoalesceKeyEvent,   ///< Marks a Key Event ID as "coalescable" for this Client: the value is the event ID to add, the negative of an event ID to remove it, or `0` to remove all.
+		                    ///  A coalescable event is buffered until the server's next update cycle and only the latest one of any events with the same ID and the same values except the first one
+		                    ///  is triggered. Intended for axis-style "_SET" events which may be sent faster than the simulator can use them. Applies to `SendKey` commands and `KeyEvent` data.
+		                    ///  The `Ack` for a coalescable event is sent when it is buffered, so an event which is then replaced by a newer one before the next cycle is acknowledged but never triggered.
+		KeyEventQueue,      ///< Read `KeyEvent` data from the "key event queue" area ("WASimCommander.KeyEventQueue.<client_name>") instead of ignoring it. Enabling this also restarts the expected queue write sequence.
+		                    ///  A Client should enable this after connecting and keep using the single `KeyEvent` data area if the server rejects the option (v1.3 and earlier). \sa KeyEventQueueHeader struct.
+	};
+	/// \name Enumeration name strings
+	/// \{
+	static const std::vector<const char *> ClientOptionNames = { "None", "PackedDataUpdates", "UpdateHeartbeat", "DeltaEpsilonHysteresis", "PackedLogRecords", "SuppressAcks", "CoalesceKeyEvent", "KeyEventQueue" };  ///< \refwc{Enums::ClientOption} enum names.
+	/// \}
+
 	/// Logging levels. \sa LogRecord struct, CommandId::Log command.
 	WSMCMND_ENUM_EXPORT enum class LogLevel : uint8_t
 	{
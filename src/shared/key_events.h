@@ -18,16 +18,13 @@ and is also available at <http://www.gnu.org/licenses/>.
 */
 
 #pragma once
-#include <map>
+#include <string_view>
+#include "utilities.h"
 
 namespace WASimCommander {
 	namespace Utilities {
 
-	// returns -1 if the name wasn't found
-	static int32_t getKeyEventId(const std::string &name)
-	{
-		using nameToIdMap_t = std::map<std::string, int32_t>;
-		static const nameToIdMap_t namesMap = {
+	static constexpr NameIdPair<int32_t> KEY_EVENT_NAMES[] = {
 			{ "NULL",     KEY_NULL },
 			{ "DEMO_STOP",     KEY_DEMO_STOP },
 			{ "REPLAY_STOP",     KEY_REPLAY_STOP },
@@ -2153,10 +2150,22 @@ namespace WASimCommander {
 			{ "VIEW_WINDOW_TITLES_TOGGLE",            KEY_WINDOW_TITLES_TOGGLE },
 			{ "VS_SLOT_INDEX_SET",                    KEY_AP_VS_SLOT_INDEX_SET },
 
-		};
+	};
+
+	static constexpr ConstNameTable KEY_EVENT_NAMES_TABLE(KEY_EVENT_NAMES);
+
+	// returns -1 if the name wasn't found
+	static constexpr int32_t getKeyEventId(std::string_view name)
+	{
+		const NameIdPair<int32_t> *el = KEY_EVENT_NAMES_TABLE.findName(name);
+		return el ? el->id : -1;
+	}
 
-		const nameToIdMap_t::const_iterator el = namesMap.find(name);
-		return el == namesMap.cend() ? -1 : el->second;
+	// returns an empty string if the ID wasn't found; for events with several names this is the first (current) one
+	static constexpr std::string_view getKeyEventName(int32_t id)
+	{
+		const NameIdPair<int32_t> *el = KEY_EVENT_NAMES_TABLE.findId(id);
+		return el ? el->name : std::string_view();
 	}
 
 	}; // ns Utilities
@@ -26,11 +26,15 @@ and are available at <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include <algorithm>
+#include <cctype>
 #include <chrono>
+#include <cstdlib>
 #include <map>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 //#include <SimConnect.h>
 
@@ -78,6 +82,13 @@ namespace WASimCommander {
 	static const char CDA_NAME_LOG_PFX[]    = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_LOG ".";       // + 8 char client name
 	static const char CDA_NAME_DATA_PFX[]   = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_DATA ".";      // + 8 char client name [+ "." + request ID (0-65535)]
 	static const char CDA_NAME_KEYEV_PFX[]  = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_KEYEVENT ".";  // + 8 char client name
+	static const char CDA_NAME_PACKED_PFX[] = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_PACKED ".";    // + 8 char client name
+	static const char CDA_NAME_LIST_PFX[]   = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_LIST ".";      // + 8 char client name
+	static const char CDA_NAME_LOGDATA_PFX[] = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_LOGDATA ".";  // + 8 char client name
+	static const char CDA_NAME_CMDBATCH_PFX[] = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_CMDBATCH ".";  // + 8 char client name
+	static const char CDA_NAME_BATCHRES_PFX[] = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_BATCHRES ".";  // + 8 char client name
+	static const char CDA_NAME_KEYQUEUE_PFX[] = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_KEYQUEUE ".";  // + 8 char client name
+	static const char CDA_NAME_SETTER_PFX[]   = WSMCMND_COMMON_NAME_PREFIX WSMCMND_CDA_NAME_SETTER ".";    // + 8 char client name
 
 	static bool isIndexedVariableType(const char type) {
 		static const std::vector<char> VAR_TYPES_INDEXED    = { 'A', 'L', 'T' };
@@ -115,6 +126,170 @@ namespace WASimCommander {
 		}
 	}
 
+	// returns the total byte size of a DataRequest value, which for indexed-range SimVar requests is the size of each element times the number of indexes
+	static inline uint32_t getRequestDataSize(const DataRequest &req) {
+		return getActualValueSize(req.valueSize) * (req.simVarIndexCount > 1 ? req.simVarIndexCount : 1);
+	}
+
+	// returns the size or type to use for the client data definition of a DataRequest value; an array of values is always defined by its byte size
+	static inline uint32_t getRequestDefinitionSize(const DataRequest &req) {
+		return req.simVarIndexCount > 1 ? getRequestDataSize(req) : req.valueSize;
+	}
+
+	// Parses the member definitions of a RequestType::Group DataRequest from its `nameOrCode`, eg. "+double;A;PLANE ALTITUDE;feet\nint32;Integer;(L:MyVar) 2 *" (see RequestType::Group for the format).
+	// `changedBitmap` is set if the list starts with a `+`. Each member is returned as a Named or Calculated type DataRequest with the group's request ID and no update period.
+	// Returns false, with the reason in `error`, if the list has no members or a member definition is invalid.
+	static bool parseGroupMembers(const DataRequest &group, std::vector<DataRequest> &members, bool &changedBitmap, std::string &error)
+	{
+		static const char *const VALUE_TYPE_NAMES[] = { "int8", "int16", "int32", "int64", "float", "double" };  // in order of DATA_TYPE_INT8 and following constants
+		auto trimmed = [](std::string_view sv) {
+			while (!sv.empty() && std::isspace((unsigned char)sv.front()))
+				sv.remove_prefix(1);
+			while (!sv.empty() && std::isspace((unsigned char)sv.back()))
+				sv.remove_suffix(1);
+			return sv;
+		};
+		auto equalsNoCase = [](std::string_view sv, std::string_view name) {
+			return sv.size() == name.size() && std::equal(sv.cbegin(), sv.cend(), name.cbegin(), [](char a, char b) { return std::tolower((unsigned char)a) == std::tolower((unsigned char)b); });
+		};
+
+		members.clear();
+		std::string_view list(group.nameOrCode, strnlen(group.nameOrCode, STRSZ_REQ));
+		if ((changedBitmap = (!list.empty() && list.front() == '+')))
+			list.remove_prefix(1);
+		while (!list.empty()) {
+			const size_t eol = list.find('\n');
+			const std::string_view line = trimmed(list.substr(0, eol));
+			list.remove_prefix(eol == std::string_view::npos ? list.size() : eol + 1);
+			if (line.empty())
+				continue;
+			const std::string memberName = "Group member " + std::to_string(members.size() + 1);
+
+			// fields: value type; variable type or calculator result type; name or code[; unit name[; delta epsilon]]
+			std::string_view fields[5];
+			size_t fieldCount = 0;
+			for (size_t pos = 0; pos <= line.size() && fieldCount < 5; ++fieldCount) {
+				const size_t sep = fieldCount < 4 ? line.find(';', pos) : std::string_view::npos;
+				fields[fieldCount] = trimmed(line.substr(pos, sep == std::string_view::npos ? std::string_view::npos : sep - pos));
+				pos = sep == std::string_view::npos ? line.size() + 1 : sep + 1;
+			}
+			if (fieldCount < 3 || fields[2].empty()) {
+				error = memberName + " definition " + std::string(line) + " needs at least a value type, variable or result type, and a name or code.";
+				return false;
+			}
+
+			uint32_t valueSize = 0;
+			for (size_t i = 0; i < std::size(VALUE_TYPE_NAMES) && !valueSize; ++i) {
+				if (equalsNoCase(fields[0], VALUE_TYPE_NAMES[i]))
+					valueSize = DATA_TYPE_INT8 - (uint32_t)i;
+			}
+			if (!valueSize) {
+				const std::string sizeStr(fields[0]);
+				char *end = nullptr;
+				valueSize = (uint32_t)std::strtoul(sizeStr.c_str(), &end, 10);
+				if (sizeStr.empty() || *end || !valueSize || valueSize >= DATA_TYPE_DOUBLE) {
+					error = memberName + " has an invalid value type " + sizeStr + ", expected a size in bytes or one of int8, int16, int32, int64, float, double.";
+					return false;
+				}
+			}
+
+			Enums::RequestType type = Enums::RequestType::Named;
+			Enums::CalcResultType resultType = Enums::CalcResultType::None;
+			char varType = 'Q';
+			if (fields[1].size() == 1 && std::isalpha((unsigned char)fields[1].front())) {
+				varType = (char)std::toupper((unsigned char)fields[1].front());
+			}
+			else {
+				type = Enums::RequestType::Calculated;
+				for (size_t i = 1; i < Enums::CalcResultTypeNames.size() && resultType == Enums::CalcResultType::None; ++i) {
+					if (equalsNoCase(fields[1], Enums::CalcResultTypeNames[i]))
+						resultType = Enums::CalcResultType(i);
+				}
+				if (resultType == Enums::CalcResultType::None) {
+					error = memberName + " has an invalid type " + std::string(fields[1]) + ", expected a variable type letter or a calculator result type name.";
+					return false;
+				}
+			}
+
+			std::string name(fields[2]);
+			uint8_t simVarIndex = 0;
+			if (varType == 'A') {
+				// optional SimVar index after the name, as in calculator code
+				const size_t sep = name.rfind(':');
+				if (sep != std::string::npos && sep + 1 < name.size() && std::all_of(name.cbegin() + sep + 1, name.cend(), [](char ch) { return std::isdigit((unsigned char)ch); })) {
+					simVarIndex = (uint8_t)std::strtoul(name.c_str() + sep + 1, nullptr, 10);
+					name.erase(sep);
+				}
+			}
+			if (fields[3].size() >= STRSZ_UNIT) {
+				error = memberName + " unit name is too long.";
+				return false;
+			}
+			float deltaEpsilon = 0.0f;
+			if (!fields[4].empty()) {
+				const std::string epsilonStr(fields[4]);
+				char *end = nullptr;
+				deltaEpsilon = std::strtof(epsilonStr.c_str(), &end);
+				if (*end) {
+					error = memberName + " has an invalid delta epsilon value " + epsilonStr + '.';
+					return false;
+				}
+			}
+			members.emplace_back(group.requestId, valueSize, type, resultType, Enums::UpdatePeriod::Never, name.c_str(), std::string(fields[3]).c_str(), varType, deltaEpsilon, 0, simVarIndex);
+		}
+		if (members.empty()) {
+			error = "The group has no members.";
+			return false;
+		}
+		return true;
+	}
+
+	// returns the size of the changed members bitmap at the start of a RequestType::Group record
+	static constexpr uint32_t getGroupBitmapSize(size_t memberCount) {
+		return uint32_t((memberCount + 7) / 8);
+	}
+
+	// returns the size of a RequestType::Group record with the given members, which is the size of any changed members bitmap plus the size of each member value
+	static inline uint32_t getGroupRecordSize(const std::vector<DataRequest> &members, bool changedBitmap) {
+		uint32_t size = changedBitmap ? getGroupBitmapSize(members.size()) : 0;
+		for (const DataRequest &m : members)
+			size += getActualValueSize(m.valueSize);
+		return size;
+	}
+
+	// Appends a Command to a command batch or batch results block as a CommandBatchRecord followed by its `sData` contents, without any trailing zero bytes.
+	// Returns false if the record doesn't fit into a data area of COMMAND_BATCH_AREA_SIZE.
+	static bool appendCommandBatchRecord(std::vector<uint8_t> &block, const Command &cmd)
+	{
+		uint16_t sSize = STRSZ_CMD - 1;
+		while (sSize && !cmd.sData[sSize - 1])
+			--sSize;
+		const size_t pos = block.size();
+		if (pos + sizeof(CommandBatchRecord) + sSize > COMMAND_BATCH_AREA_SIZE)
+			return false;
+		const CommandBatchRecord rec { cmd.token, cmd.uData, cmd.fData, cmd.commandId, 0, sSize };
+		block.resize(pos + sizeof(CommandBatchRecord) + sSize);
+		memcpy(block.data() + pos, &rec, sizeof(CommandBatchRecord));
+		memcpy(block.data() + pos + sizeof(CommandBatchRecord), cmd.sData, sSize);
+		return true;
+	}
+
+	// Reads one CommandBatchRecord at `pos` into `cmd` and advances `pos` past the record. Returns false if the record is invalid or extends past `end`.
+	static bool readCommandBatchRecord(const uint8_t *&pos, const uint8_t *const end, Command &cmd)
+	{
+		if (end - pos < (ptrdiff_t)sizeof(CommandBatchRecord))
+			return false;
+		CommandBatchRecord rec;
+		memcpy(&rec, pos, sizeof(CommandBatchRecord));
+		pos += sizeof(CommandBatchRecord);
+		if (rec.sDataSize >= STRSZ_CMD || end - pos < (ptrdiff_t)rec.sDataSize)
+			return false;
+		cmd = Command(rec.commandId, rec.uData, nullptr, rec.fData, rec.token);
+		memcpy(cmd.sData, pos, rec.sDataSize);
+		pos += rec.sDataSize;
+		return true;
+	}
+
 	static inline bool fuzzyCompare(float p1, float p2) 	{
 		p1 += 1.0f; p2 += 1.0f;
 		return (std::fabs(p1 - p2) * 1000000.f <= std::min(std::fabs(p1), std::fabs(p2)));
@@ -146,6 +321,90 @@ namespace WASimCommander {
 		return T();
 	}
 
+	// Name and ID pair used to define the static lists for `ConstNameTable`.
+	template <typename ID>
+	struct NameIdPair
+	{
+		std::string_view name;
+		ID id;
+	};
+
+	// Compile-time lookup table for a static list of unique names and their IDs, with a reverse ID to name index.
+	// Both indexes are open-addressed hash tables with (at least) twice as many slots as entries and are built entirely by the compiler,
+	// so nothing is constructed at startup and lookups do not allocate (a name lookup is typically one string comparison).
+	// If several names share an ID, the reverse lookup returns the first one in the list.
+	template <typename ID, size_t N>
+	class ConstNameTable
+	{
+		static_assert(N < 0xFFFF, "ConstNameTable supports up to 65534 entries.");
+
+	public:
+		constexpr ConstNameTable(const NameIdPair<ID> (&list)[N]) : m_list(list)
+		{
+			for (size_t i = 0; i < N; ++i) {
+				size_t slot = nameSlot(list[i].name);
+				while (m_names[slot] && list[m_names[slot] - 1].name != list[i].name)
+					slot = (slot + 1) & SLOT_MASK;
+				if (!m_names[slot])
+					m_names[slot] = uint16_t(i + 1);
+
+				slot = idSlot(list[i].id);
+				while (m_ids[slot] && list[m_ids[slot] - 1].id != list[i].id)
+					slot = (slot + 1) & SLOT_MASK;
+				if (!m_ids[slot])
+					m_ids[slot] = uint16_t(i + 1);
+			}
+		}
+
+		// Returns the entry with the given name, or `nullptr` if not found.
+		constexpr const NameIdPair<ID> *findName(std::string_view name) const
+		{
+			for (size_t slot = nameSlot(name); m_names[slot]; slot = (slot + 1) & SLOT_MASK) {
+				if (m_list[m_names[slot] - 1].name == name)
+					return &m_list[m_names[slot] - 1];
+			}
+			return nullptr;
+		}
+
+		// Returns the (first) entry with the given ID, or `nullptr` if not found.
+		constexpr const NameIdPair<ID> *findId(ID id) const
+		{
+			for (size_t slot = idSlot(id); m_ids[slot]; slot = (slot + 1) & SLOT_MASK) {
+				if (m_list[m_ids[slot] - 1].id == id)
+					return &m_list[m_ids[slot] - 1];
+			}
+			return nullptr;
+		}
+
+		constexpr size_t size() const { return N; }
+
+	private:
+		static constexpr size_t slotCount() {
+			size_t count = 1;
+			while (count < N * 2)
+				count <<= 1;
+			return count;
+		}
+		static constexpr size_t SLOT_COUNT = slotCount();
+		static constexpr size_t SLOT_MASK = SLOT_COUNT - 1;
+
+		// 32-bit FNV-1a
+		static constexpr size_t nameSlot(std::string_view name) {
+			uint32_t hash = 2166136261U;
+			for (size_t i = 0; i < name.size(); ++i)
+				hash = (hash ^ uint8_t(name[i])) * 16777619U;
+			return hash & SLOT_MASK;
+		}
+		// Fibonacci hashing; the IDs are often sequential
+		static constexpr size_t idSlot(ID id) {
+			return ((uint32_t)id * 2654435769U >> 15) & SLOT_MASK;
+		}
+
+		const NameIdPair<ID> *m_list;
+		uint16_t m_names[SLOT_COUNT] {};  // list index + 1, zero for empty slots
+		uint16_t m_ids[SLOT_COUNT] {};
+	};
+
 	template <typename T = uint8_t>
 	static const std::string byteArrayToHex(const T *range, size_t len, const char sep = ':') noexcept
 	{